@@ -1,7 +1,7 @@
 #include "InsertionBinary_HR.hpp"
+#include "../../common/CsvLoader.hpp"
+#include "../../common/Snapshot.hpp"
 #include <iostream>
-#include <fstream>
-#include <sstream>
 #include <algorithm>
 #include <iomanip>
 #include <limits>
@@ -10,6 +10,8 @@
 using namespace std;
 using namespace std::chrono;
 
+namespace insertion_binary_hr {
+
 // ---------- Utility ----------
 string HRSystem::trim(const string &s) {
     size_t start = s.find_first_not_of(" \t\"");
@@ -25,74 +27,127 @@ string HRSystem::toLower(string str) {
 // ---------- Constructors ----------
 Candidate::Candidate() {
     name = "";
-    skillCount = matchedSkills = matchedWeight = 0;
+    skillStart = skillCount = matchedSkills = matchedWeight = 0;
     percentage = 0.0;
 }
 
 JobHR::JobHR() {
     name = "";
-    skillCount = 0;
+    skillStart = skillCount = 0;
 }
 
 HRSystem::HRSystem() {
-    jobCount = candCount = 0;
+    jobs = nullptr;
+    candidates = nullptr;
+    skillPool = nullptr;
+    candidateMasks = nullptr;
+    hits = scoredSkills = scoredWeight = nullptr;
+    jobCount = jobCapacity = 0;
+    candCount = candCapacity = 0;
+    poolCount = poolCapacity = 0;
+}
+
+HRSystem::~HRSystem() {
+    delete[] jobs;
+    delete[] candidates;
+    delete[] skillPool;
+    delete[] candidateMasks;
+    delete[] hits;
+    delete[] scoredSkills;
+    delete[] scoredWeight;
+}
+
+// ---------- Growable Stores ----------
+// Doubles capacity, moving the first count elements across
+template<typename T>
+static void grow(T*& data, int count, int &capacity) {
+    int newCapacity = capacity == 0 ? INITIAL_CAPACITY : capacity * 2;
+    T* newData = new T[newCapacity];
+    for (int i = 0; i < count; i++)
+        newData[i] = move(data[i]);
+    delete[] data;
+    data = newData;
+    capacity = newCapacity;
+}
+
+void HRSystem::addSkill(SkillId id) {
+    if (poolCount == poolCapacity) grow(skillPool, poolCount, poolCapacity);
+    skillPool[poolCount++] = id;
 }
 
 // ---------- Load Data ----------
-void HRSystem::loadJobs(const string &filename) {
-    ifstream file(filename);
-    if (!file.is_open()) {
+bool HRSystem::loadJobs(const string &filename) {
+    CsvReader reader(filename);
+    if (!reader.isOpen()) {
         cerr << "Error: Cannot open " << filename << endl;
-        exit(1);
+        return false;
     }
 
-    string line;
-    while (getline(file, line) && jobCount < MAX_JOBS) {
-        if (line.empty()) continue;
-        stringstream ss(line);
-        string jobName, skillsLine;
-        getline(ss, jobName, ',');
-        getline(ss, skillsLine);
-
-        jobs[jobCount].name = trim(jobName);
-        jobs[jobCount].skillCount = 0;
-
-        stringstream skillStream(skillsLine);
-        string skill;
-        while (getline(skillStream, skill, ',') && jobs[jobCount].skillCount < MAX_SKILLS)
-            jobs[jobCount].skills[jobs[jobCount].skillCount++] = toLower(trim(skill));
+    CsvRow row;
+    while (reader.next(row)) {
+        if (jobCount == jobCapacity) grow(jobs, jobCount, jobCapacity);
+        JobHR &job = jobs[jobCount];
+        job.name = string(row.key);
+        job.key = CsvReader::normalizeKey(row.key);
+        job.skillStart = poolCount;
+        job.skillCount = 0;
+
+        SkillTokenizer tokens(row.skills);
+        string_view skill;
+        while (tokens.next(skill)) {
+            SkillId id = SkillDictionary::global().intern(skill);
+            if (id != INVALID_SKILL) {
+                addSkill(id);
+                job.skillCount++;
+            }
+        }
 
         jobCount++;
     }
-    file.close();
+    return true;
 }
 
-void HRSystem::loadCandidates(const string &filename) {
-    ifstream file(filename);
-    if (!file.is_open()) {
+bool HRSystem::loadCandidates(const string &filename) {
+    // Maps candidates.bin when the cleaner wrote one, parses the CSV otherwise
+    RecordReader reader(filename);
+    if (!reader.isOpen()) {
         cerr << "Error: Cannot open " << filename << endl;
-        exit(1);
+        return false;
     }
 
-    string line;
-    while (getline(file, line) && candCount < MAX_CANDIDATES) {
-        if (line.empty()) continue;
-        stringstream ss(line);
-        string name, skillsLine;
-        getline(ss, name, ',');
-        getline(ss, skillsLine);
-
-        candidates[candCount].name = trim(name);
-        candidates[candCount].skillCount = 0;
-
-        stringstream skillStream(skillsLine);
-        string skill;
-        while (getline(skillStream, skill, ',') && candidates[candCount].skillCount < MAX_SKILLS)
-            candidates[candCount].skills[candidates[candCount].skillCount++] = toLower(trim(skill));
+    string_view name;
+    const SkillId* ids;
+    int idCount;
+    while (reader.next(name, ids, idCount)) {
+        if (candCount == candCapacity) grow(candidates, candCount, candCapacity);
+        Candidate &c = candidates[candCount];
+        c.name = string(name);
+        c.skillStart = poolCount;
+        c.skillCount = idCount;
+        for (int k = 0; k < idCount; k++) {
+            addSkill(ids[k]);
+            skillIndex.add(candCount, ids[k]);
+        }
 
         candCount++;
     }
-    file.close();
+    skillIndex.build(candCount);
+    matchCache.clear();
+    resultCache.invalidate();
+
+    // The pool stops moving once loading is done
+    delete[] candidateMasks;
+    candidateMasks = new SkillMask[candCount > 0 ? candCount : 1];
+    for (int i = 0; i < candCount; i++)
+        candidateMasks[i] = SkillBitset::maskOf(skillsOf(candidates[i]), candidates[i].skillCount);
+
+    delete[] hits;
+    delete[] scoredSkills;
+    delete[] scoredWeight;
+    hits = new int[candCount > 0 ? candCount : 1];
+    scoredSkills = new int[candCount > 0 ? candCount : 1];
+    scoredWeight = new int[candCount > 0 ? candCount : 1];
+    return true;
 }
 
 // ---------- Display ----------
@@ -102,7 +157,8 @@ void HRSystem::displayJobs() {
         cout << " " << i + 1 << ". " << jobs[i].name << endl;
 }
 
-void HRSystem::displayTop5(const Candidate matchedList[], int matchedCount, int totalWeight) {
+void HRSystem::displayTop5(const CachedResult &result, int totalWeight) {
+    AllocScope displaying(ALLOC_DISPLAY);
     cout << "\n===== Top 5 Matching Candidates =====\n";
     cout << left << setw(20) << "Candidate"
          << setw(20) << "Matched Skills"
@@ -110,34 +166,36 @@ void HRSystem::displayTop5(const Candidate matchedList[], int matchedCount, int
          << setw(20) << "Score (Weight/Total)" << endl;
     cout << "--------------------------------------------------------------------------\n";
 
-    int limit = (matchedCount < 5) ? matchedCount : 5;
-    for (int i = 0; i < limit; ++i) {
-        cout << left << setw(20) << matchedList[i].name
-             << setw(20) << matchedList[i].matchedSkills
-             << setw(20) << matchedList[i].matchedWeight
+    for (int i = 0; i < result.rowCount; ++i) {
+        const CachedRow &c = result.rows[i];
+        cout << left << setw(20) << c.name
+             << setw(20) << c.matchedSkills
+             << setw(20) << c.matchedWeight
              << fixed << setprecision(1)
-             << matchedList[i].matchedWeight << "/" << totalWeight
-             << " (" << matchedList[i].percentage << "%)" << endl;
+             << c.matchedWeight << "/" << totalWeight
+             << " (" << c.score << "%)" << endl;
     }
-    if (limit == 0)
+    if (result.rowCount == 0)
         cout << "!! No matching candidates found.\n";
 }
 
 
 // ---------- Binary Search ----------
-int HRSystem::binarySearchTimed(const string &target, double &binaryTime, size_t &binaryMemory, int selectedCount) {
-    string targetLower = toLower(target);
+int HRSystem::binarySearchTimed(const string &target, double &binaryTime, long long &binaryMemory, int selectedCount) {
+    MemoryPhase memory(ALLOC_SEARCH);
+    memory.start();
+    string targetKey = CsvReader::normalizeKey(target);
     auto start = high_resolution_clock::now();
 
     int low = 0, high = jobCount - 1, result = -1;
 
     while (low <= high) {
         int mid = (low + high) / 2;
-        string jobLower = toLower(jobs[mid].name);
-        if (jobLower == targetLower) {
+        int order = jobs[mid].key.compare(targetKey);
+        if (order == 0) {
             result = mid;
             break;
-        } else if (jobLower < targetLower)
+        } else if (order < 0)
             low = mid + 1;
         else
             high = mid - 1;
@@ -151,10 +209,8 @@ int HRSystem::binarySearchTimed(const string &target, double &binaryTime, size_t
 
     auto end = high_resolution_clock::now();
     binaryTime = duration<double, milli>(end - start).count();
-
-    // Memory estimation: base vars + scaling with skills (each skill ~256 bytes)
-    binaryMemory = sizeof(low) + sizeof(high) + sizeof(result) + targetLower.capacity()
-                   + selectedCount * 256; // 6 skills → ~1.5 KB
+    memory.stop();
+    binaryMemory = memory.heapDeltaBytes();
 
     return result;
 }
@@ -165,14 +221,18 @@ int HRSystem::binarySearchTimed(const string &target, double &binaryTime, size_t
 
 
 // ---------- Insertion Sort ----------
-void HRSystem::insertionSortTimed(Candidate list[], int n, double &insertionTime, size_t &sortMemory, int selectedCount) {
+// percentage is matchedWeight over the query's total weight, so the integer
+// weight alone orders the list the way the displayed scores do
+void HRSystem::insertionSortTimed(MatchEntry list[], int n, double &insertionTime, long long &sortMemory) {
+    MemoryPhase memory(ALLOC_SORT);
+    memory.start();
     auto start = high_resolution_clock::now();
 
-    Candidate key;
+    MatchEntry key;
     for (int i = 1; i < n; ++i) {
         key = list[i];
         int j = i - 1;
-        while (j >= 0 && list[j].percentage < key.percentage) {
+        while (j >= 0 && list[j].matchedWeight < key.matchedWeight) {
             list[j + 1] = list[j];
             j--;
         }
@@ -181,25 +241,198 @@ void HRSystem::insertionSortTimed(Candidate list[], int n, double &insertionTime
 
     auto end = high_resolution_clock::now();
     insertionTime = duration<double, milli>(end - start).count();
+    memory.stop();
+    sortMemory = memory.heapDeltaBytes();
+}
+
+
+// ---------- Counting Sort ----------
+// Same order as insertionSortTimed, keyed on the same integer weight
+void HRSystem::countingSortTimed(MatchEntry list[], int n, double &countingTime, long long &sortMemory) {
+    MemoryPhase memory(ALLOC_SORT);
+    memory.start();
+    auto start = high_resolution_clock::now();
 
-    // Memory for sorting: key + loop indices + selected skills per candidate
-    sortMemory = sizeof(key)           // key temporary
-               + sizeof(int) * 2       // i and j
-               + n * sizeof(int) * selectedCount; // matched skills & weight tracking
+    uint64_t* keys = new uint64_t[n > 0 ? n : 1];
+    int* order = new int[n > 0 ? n : 1];
+    for (int i = 0; i < n; ++i) keys[i] = list[i].matchedWeight;
+    CountingRank::rank(keys, n, order);
+
+    MatchEntry* ranked = new MatchEntry[n > 0 ? n : 1];
+    for (int i = 0; i < n; ++i) ranked[i] = list[order[i]];
+    for (int i = 0; i < n; ++i) list[i] = ranked[i];
+    delete[] ranked;
+    delete[] order;
+    delete[] keys;
+
+    auto end = high_resolution_clock::now();
+    countingTime = duration<double, milli>(end - start).count();
+    memory.stop();
+    sortMemory = memory.heapDeltaBytes();
+}
+
+
+// ---------- Top-K Selection ----------
+// Same order as insertionSortTimed, but only the first k slots are ranked;
+// the rest of the list is left unsorted.
+void HRSystem::selectTopTimed(MatchEntry list[], int n, int k, double &selectTime, long long &selectMemory) {
+    MemoryPhase memory(ALLOC_SORT);
+    memory.start();
+    auto start = high_resolution_clock::now();
+
+    auto better = [&](int a, int b) { return list[a].matchedWeight > list[b].matchedWeight; };
+    TopK<int, decltype(better)> top(k, better);
+    for (int i = 0; i < n; ++i)
+        top.push(i);
+
+    int* order = new int[k > 0 ? k : 1];
+    int kept = top.take(order);
+    MatchEntry* picked = new MatchEntry[kept];
+    for (int i = 0; i < kept; ++i) picked[i] = list[order[i]];
+    for (int i = 0; i < kept; ++i) list[i] = picked[i];
+    delete[] picked;
+    delete[] order;
+
+    auto end = high_resolution_clock::now();
+    selectTime = duration<double, milli>(end - start).count();
+    memory.stop();
+    selectMemory = memory.heapDeltaBytes();
 }
 
 
-// ---------- Base Memory ----------
-size_t HRSystem::calculateBaseMemory() const {
-    size_t total = (jobCount * sizeof(JobHR)) + (candCount * sizeof(Candidate));
-    total += jobCount * 32 + candCount * 64;
-    return total;
+// ---------- Matching ----------
+// Lists candidate i in matchCache; its hit mask is only built here when the
+// skills have no mask bits, rescore() derives it from candidateMasks otherwise
+void HRSystem::recordMatch(int i) {
+    if (matchCache.usesSkillMasks()) {
+        matchCache.add(i);
+        return;
+    }
+    SkillMask hitMask = 0;
+    const SkillId* skills = skillsOf(candidates[i]);
+    for (int k = 0; k < candidates[i].skillCount; k++)
+        hitMask |= matchCache.slotOf(skills[k]);
+    matchCache.add(i, hitMask);
 }
 
+int HRSystem::matchCandidates(const SkillId selectedIds[], const int weights[], int selectedCount, MatchEntry matches[]) {
+    int totalWeight = 0;
+    for (int w = 0; w < selectedCount; w++)
+        totalWeight += weights[w];
+
+    int matchedCount = 0;
+
+    // Same skills as the last search, only the weights changed: rescore the
+    // cached matches instead of searching again
+    if (matchCache.rescore(selectedIds, weights, selectedCount, candidateMasks)) {
+        for (int k = 0; k < matchCache.size(); k++) {
+            Candidate &c = candidates[matchCache.candidate(k)];
+            c.matchedSkills = matchCache.matchedSkills(k);
+            c.matchedWeight = matchCache.matchedWeight(k);
+            c.percentage = (totalWeight == 0) ? 0.0 : (double)c.matchedWeight / totalWeight * 100.0;
+            matches[matchedCount++] = { c.matchedWeight, matchCache.candidate(k) };
+        }
+        return matchedCount;
+    }
+    bool record = matchCache.begin(selectedIds, weights, selectedCount);
+
+    // Posting lists for rare skills; otherwise ScoringKernel over the mask
+    // array when every skill has a bit, ID compares as the last resort
+    WeightedQuery query;
+    bool useBitset = SkillBitset::vocabularyFits() &&
+                     SkillBitset::buildQuery(selectedIds, weights, selectedCount, query);
+
+    if (skillIndex.isSelective(selectedIds, selectedCount)) {
+        // Rare skills: only visit the candidates on their posting lists
+        int hitCount = skillIndex.query(selectedIds, weights, selectedCount, hits, scoredSkills, scoredWeight);
+        for (int k = 0; k < hitCount; k++) {
+            Candidate &c = candidates[hits[k]];
+            c.matchedSkills = scoredSkills[k];
+            c.matchedWeight = scoredWeight[k];
+            c.percentage = (totalWeight == 0) ? 0.0 : (double)c.matchedWeight / totalWeight * 100.0;
+            matches[matchedCount++] = { c.matchedWeight, hits[k] };
+            if (record) recordMatch(hits[k]);
+        }
+    } else {
+        // Scored chunk by chunk on the thread pool; chunks only write their
+        // own candidates, and the serial pass below keeps load order
+        ThreadPool::global().parallelFor(candCount, DEFAULT_GRAIN, [&](int, int begin, int end) {
+            if (useBitset)
+                ScoringKernel::score(candidateMasks + begin, end - begin, query,
+                                     scoredSkills + begin, scoredWeight + begin);
+
+            for (int i = begin; i < end; i++) {
+                candidates[i].matchedSkills = 0;
+                candidates[i].matchedWeight = 0;
+                if (useBitset) {
+                    candidates[i].matchedSkills = scoredSkills[i];
+                    candidates[i].matchedWeight = scoredWeight[i];
+                } else {
+                    const SkillId* skills = skillsOf(candidates[i]);
+                    for (int j = 0; j < selectedCount; j++) {
+                        for (int k = 0; k < candidates[i].skillCount; k++) {
+                            if (selectedIds[j] == skills[k]) {
+                                candidates[i].matchedSkills++;
+                                candidates[i].matchedWeight += weights[j];
+                            }
+                        }
+                    }
+                }
+                candidates[i].percentage = (totalWeight == 0) ? 0.0 :
+                    (double)candidates[i].matchedWeight / totalWeight * 100.0;
+            }
+        });
+
+        for (int i = 0; i < candCount; i++) {
+            if (candidates[i].matchedSkills > 0) {
+                matches[matchedCount++] = { candidates[i].matchedWeight, i };
+                if (record) recordMatch(i);
+            }
+        }
+    }
+
+    matchCache.finish();
+    return matchedCount;
+}
+
+// ---------- Ranking ----------
+void HRSystem::rankMatches(MatchEntry list[], int n, double &sortTime, long long &sortMemory) {
+    if (Ranking::selectTop(TOP_CANDIDATES, n))
+        selectTopTimed(list, n, TOP_CANDIDATES, sortTime, sortMemory);
+    else if (Ranking::counting())
+        countingSortTimed(list, n, sortTime, sortMemory);
+    else
+        insertionSortTimed(list, n, sortTime, sortMemory);
+}
+
+
+bool HRSystem::rankQuery(int jobIndex, const SkillId selectedIds[], const int weights[], int selectedCount, CachedResult &result) {
+    string key = QueryCache::keyOf(jobs[jobIndex].key, selectedIds, weights, selectedCount);
+    const CachedResult* cached = resultCache.find(key);
+    if (cached) {
+        result = *cached;
+        return true;
+    }
+
+    result = CachedResult();
+    MatchEntry* matches = new MatchEntry[candCount > 0 ? candCount : 1];
+    result.matchedCount = matchCandidates(selectedIds, weights, selectedCount, matches);
+    rankMatches(matches, result.matchedCount, result.sortTimeMS, result.sortMemoryBytes);
+
+    int limit = (result.matchedCount < TOP_CANDIDATES) ? result.matchedCount : TOP_CANDIDATES;
+    for (int i = 0; i < limit; ++i) {
+        const Candidate &c = candidates[matches[i].index];
+        result.addRow(c.name, c.matchedSkills, c.matchedWeight, c.percentage);
+    }
+    delete[] matches;
+    resultCache.store(key, result);
+    return false;
+}
+
+
 // ---------- Search & Match ----------
 void HRSystem::searchAndMatch() {
     auto systemStart = high_resolution_clock::now();
-    size_t baseMemory = calculateBaseMemory();
 
     while (true) {
         displayJobs();
@@ -208,8 +441,8 @@ void HRSystem::searchAndMatch() {
         getline(cin, jobInput);
         jobInput = toLower(trim(jobInput));
 
-        double binaryTime = 0.0, insertionTime = 0.0;
-        size_t binaryMemory = 0, sortMemory = 0;
+        double binaryTime = 0.0;
+        long long binaryMemory = 0;
 
         int selectedCount = 0; // default
         int jobIndex = binarySearchTimed(jobInput, binaryTime, binaryMemory, selectedCount);
@@ -219,10 +452,12 @@ void HRSystem::searchAndMatch() {
             continue;
         }
 
+        const SkillDictionary &dict = SkillDictionary::global();
+        const SkillId* jobSkills = skillsOf(jobs[jobIndex]);
         cout << "\nJob Found: " << jobs[jobIndex].name << endl;
         cout << "Required Skills:\n";
         for (int i = 0; i < jobs[jobIndex].skillCount; i++)
-            cout << " " << i + 1 << ". " << jobs[jobIndex].skills[i] << endl;
+            cout << " " << i + 1 << ". " << dict.key(jobSkills[i]) << endl;
 
         cout << "\nEnter number of skills to use for matching: ";
         while (true) {
@@ -234,8 +469,9 @@ void HRSystem::searchAndMatch() {
             } else break;
         }
 
-        int selectedIdx[MAX_SKILLS], weights[MAX_SKILLS];
-        fill(begin(selectedIdx), end(selectedIdx), -1);
+        int* selectedIdx = new int[selectedCount];
+        int* weights = new int[selectedCount];
+        fill(selectedIdx, selectedIdx + selectedCount, -1);
 
         for (int i = 0; i < selectedCount; i++) {
             int skillNum;
@@ -264,7 +500,7 @@ void HRSystem::searchAndMatch() {
         for (int i = 0; i < selectedCount; i++) {
             int weight;
             while (true) {
-                cout << "Weight for \"" << jobs[jobIndex].skills[selectedIdx[i]] << "\": ";
+                cout << "Weight for \"" << dict.key(jobSkills[selectedIdx[i]]) << "\": ";
                 cin >> weight;
                 if (cin.fail() || weight < 1 || weight > 10) {
                     cout << "X Invalid weight. Enter 1–10.\n";
@@ -276,7 +512,7 @@ void HRSystem::searchAndMatch() {
         }
         cin.ignore(numeric_limits<streamsize>::max(), '\n');
 
-        // Recalculate binaryMemory with actual selectedCount
+        // Time the search again with the actual selectedCount
         jobIndex = binarySearchTimed(jobInput, binaryTime, binaryMemory, selectedCount);
 
         // Calculate total possible weight
@@ -284,30 +520,16 @@ void HRSystem::searchAndMatch() {
         for (int w = 0; w < selectedCount; w++)
             totalWeight += weights[w];
 
-        Candidate matchedList[MAX_CANDIDATES];
-        int matchedCount = 0;
+        SkillId* selectedIds = new SkillId[selectedCount];
+        for (int j = 0; j < selectedCount; j++)
+            selectedIds[j] = jobSkills[selectedIdx[j]];
 
-        for (int i = 0; i < candCount; i++) {
-            candidates[i].matchedSkills = 0;
-            candidates[i].matchedWeight = 0;
-            for (int j = 0; j < selectedCount; j++) {
-                string skill = jobs[jobIndex].skills[selectedIdx[j]];
-                for (int k = 0; k < candidates[i].skillCount; k++) {
-                    if (skill == candidates[i].skills[k]) {
-                        candidates[i].matchedSkills++;
-                        candidates[i].matchedWeight += weights[j];
-                    }
-                }
-            }
-            candidates[i].percentage = (totalWeight == 0) ? 0.0 :
-                (double)candidates[i].matchedWeight / totalWeight * 100.0;
-
-            if (candidates[i].matchedSkills > 0)
-                matchedList[matchedCount++] = candidates[i];
-        }
-
-        insertionSortTimed(matchedList, matchedCount, insertionTime, sortMemory, selectedCount);
-        displayTop5(matchedList, matchedCount, totalWeight);
+        CachedResult result;
+        bool cached = rankQuery(jobIndex, selectedIds, weights, selectedCount, result);
+        displayTop5(result, totalWeight);
+        delete[] selectedIds;
+        delete[] weights;
+        delete[] selectedIdx;
 
         int choice;
         while (true) {
@@ -322,8 +544,14 @@ void HRSystem::searchAndMatch() {
                 cout << "\n----- Performance Summary -----\n";
                 cout << "Binary Search Time        : " << fixed << setprecision(3) << binaryTime << " ms\n";
                 cout << "Binary Search Memory      : " << fixed << setprecision(3) << (binaryMemory / 1024.0) << " KB\n";
-                cout << "Insertion Sort Time       : " << fixed << setprecision(3) << insertionTime << " ms\n";
-                cout << "Insertion Sort Memory     : " << fixed << setprecision(3) << (sortMemory / 1024.0) << " KB\n";
+                cout << "Insertion Sort Time       : " << fixed << setprecision(3) << result.sortTimeMS << " ms\n";
+                cout << "Insertion Sort Memory     : " << fixed << setprecision(3) << (result.sortMemoryBytes / 1024.0) << " KB\n";
+                if (resultCache.enabled())
+                    cout << "Query Cache               : " << (cached ? "hit" : "miss") << " (" << resultCache.hits()
+                         << " hits, " << resultCache.misses() << " misses)\n";
+                cout << "Process RSS               : " << MemoryStats::currentRssKB() << " KB\n";
+                cout << "Peak RSS                  : " << MemoryStats::peakRssKB() << " KB\n";
+                AllocStats::printReport();
             } 
             else if (choice == 3) {
                 cout << "\nExiting HR System...\n";
@@ -339,16 +567,51 @@ void HRSystem::searchAndMatch() {
 }
 
 
-// ---------- Run ----------
-void runHRSystem() {
+// ---------- Engine ----------
+class InsertionBinaryHREngine : public Engine {
+private:
     HRSystem hr;
-    hr.loadJobs("job_description/mergejob.csv");
-    hr.loadCandidates("resume/candidates.csv");
-    hr.searchAndMatch();
-}
+
+public:
+    const char* name() const override { return "Array Insertion Sort and Binary Search (HR)"; }
+
+    bool loadFrom(const string &jobsFile, const string &candidatesFile) override {
+        return hr.loadJobs(jobsFile) && hr.loadCandidates(candidatesFile);
+    }
+
+    void query() override { hr.searchAndMatch(); }
+
+    int recordCount() const override { return hr.getCandidateCount(); }
+
+    bool runQuery(const EngineQuery &query) override {
+        double searchTime;
+        long long searchMemory;
+        int jobIndex = hr.binarySearchTimed(query.jobTitle, searchTime, searchMemory);
+        if (jobIndex == -1) return false;
+
+        int room = query.skillCount > 0 ? query.skillCount : 1;
+        SkillId* ids = new SkillId[room];
+        int* weights = new int[room];
+        int count = resolveQuerySkills(query, ids, weights, room);
+
+        CachedResult result;
+        hr.rankQuery(jobIndex, ids, weights, count, result);
+        delete[] weights;
+        delete[] ids;
+        return true;
+    }
+};
+
+Engine* createEngine() { return new InsertionBinaryHREngine(); }
+
+} // namespace insertion_binary_hr
 
 // ---------- Main ----------
-int main() {
-    runHRSystem();
-    return 0;
-}
\ No newline at end of file
+#ifndef ENGINE_NO_MAIN
+int main(int argc, char* argv[]) {
+    ThreadPool::configure(ThreadPool::threadsFromArgs(argc, argv));
+    Ranking::configure(Ranking::modeFromArgs(argc, argv));
+    QueryCache::configure(QueryCache::capacityFromArgs(argc, argv));
+    return runEngine(insertion_binary_hr::createEngine());
+}
+#endif
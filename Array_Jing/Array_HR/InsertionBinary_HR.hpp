@@ -5,18 +5,31 @@
 #include <string>
 #include <iomanip>
 #include <chrono>
+#include "../../common/SkillDictionary.hpp"
+#include "../../common/SkillBitset.hpp"
+#include "../../common/ScoringKernel.hpp"
+#include "../../common/SkillIndex.hpp"
+#include "../../common/MatchCache.hpp"
+#include "../../common/QueryCache.hpp"
+#include "../../common/TopK.hpp"
+#include "../../common/CountingRank.hpp"
+#include "../../common/ThreadPool.hpp"
+#include "../../common/MemoryStats.hpp"
+#include "../../common/Engine.hpp"
 using namespace std;
 using namespace std::chrono;
 
+namespace insertion_binary_hr {
+
 // ---------- Constants ----------
-const int MAX_JOBS = 50;
-const int MAX_SKILLS = 20;
-const int MAX_CANDIDATES = 500;
+const int TOP_CANDIDATES = 5;     // rows shown by displayTop5
+const int INITIAL_CAPACITY = 64;  // first size of each growable store
 
 // ---------- Candidate ----------
+// Skills are a run of HRSystem's skill pool, read through skillsOf()
 struct Candidate {
     string name;
-    string skills[MAX_SKILLS];
+    int skillStart;
     int skillCount;
     int matchedSkills;
     int matchedWeight;
@@ -25,44 +38,91 @@ struct Candidate {
     Candidate();
 };
 
+// ---------- Match Entry ----------
+// What the ranking moves around: the weight it orders by and where the
+// full record sits in candidates[]. Only the rows displayTop5 prints are
+// ever looked up, so a query's copies stay 8 bytes per match however many
+// skills a candidate carries.
+struct MatchEntry {
+    int matchedWeight;
+    int index;
+};
+
 // ---------- Job ----------
 struct JobHR {
     string name;
-    string skills[MAX_SKILLS];
+    string key;        // normalized name, what binarySearchTimed compares
+    int skillStart;
     int skillCount;
 
     JobHR();
 };
 
 // ---------- HR System ----------
+// Records are held in heap stores that double when full, so the input
+// size alone decides how many are loaded.
 class HRSystem {
 private:
-    JobHR jobs[MAX_JOBS];
-    Candidate candidates[MAX_CANDIDATES];
-    int jobCount;
-    int candCount;
+    JobHR* jobs;
+    Candidate* candidates;
+    SkillId* skillPool;         // every job's then every candidate's skills, back to back
+    SkillMask* candidateMasks;  // skill bitsets, contiguous for ScoringKernel
+    SkillIndex skillIndex;      // skill -> candidate postings
+    MatchCache matchCache;      // last search's matches, for weight-only changes
+    QueryCache resultCache;     // shown rows and timings of recent queries
+    int jobCount, jobCapacity;
+    int candCount, candCapacity;
+    int poolCount, poolCapacity;
+
+    // Scratch for matchCandidates, candCount entries each, allocated once
+    // the candidates are loaded
+    int* hits;
+    int* scoredSkills;
+    int* scoredWeight;
+
+    void addSkill(SkillId id);
+    void recordMatch(int i);
 
 public:
     HRSystem();
+    ~HRSystem();
+
+    HRSystem(const HRSystem&) = delete;
+    HRSystem& operator=(const HRSystem&) = delete;
+
+    const SkillId* skillsOf(const JobHR &job) const { return skillPool + job.skillStart; }
+    const SkillId* skillsOf(const Candidate &c) const { return skillPool + c.skillStart; }
 
     // Utility
     string trim(const string &s);
     string toLower(string str);
 
-    // File handling
-    void loadJobs(const string &filename);
-    void loadCandidates(const string &filename);
+    // File handling (false when the file cannot be opened)
+    bool loadJobs(const string &filename);
+    bool loadCandidates(const string &filename);
 
     // Display
     void displayJobs();
-    void displayTop5(const Candidate matchedList[], int matchedCount, int totalWeight);
-
-    // Core algorithms
-    int binarySearchTimed(const string &target, double &binaryTime, size_t &binaryMemory, int selectedCount = 0);
-    void insertionSortTimed(Candidate list[], int n, double &insertionTime, size_t &sortMemory, int selectedCount);
-
-    // Base memory
-    size_t calculateBaseMemory() const;
+    void displayTop5(const CachedResult &result, int totalWeight);
+
+    // Core algorithms; the memory out-parameters are measured heap deltas in bytes
+    int binarySearchTimed(const string &target, double &binaryTime, long long &binaryMemory, int selectedCount = 0);
+    void insertionSortTimed(MatchEntry list[], int n, double &insertionTime, long long &sortMemory);
+    void countingSortTimed(MatchEntry list[], int n, double &countingTime, long long &sortMemory);
+    void selectTopTimed(MatchEntry list[], int n, int k, double &selectTime, long long &selectMemory);
+
+    // Scores every candidate on the selected skills in place and writes one
+    // entry per matched candidate to matches (room for getCandidateCount()),
+    // in load order; returns how many. Re-running the last selection with
+    // new weights rescores the cached matches without searching.
+    int matchCandidates(const SkillId selectedIds[], const int weights[], int selectedCount, MatchEntry matches[]);
+    // Top-K selection when only a few rows are shown, insertion sort
+    // otherwise, or counting sort when the ranking mode asks for it
+    void rankMatches(MatchEntry list[], int n, double &sortTime, long long &sortMemory);
+    // Matches and ranks the selection for jobs[jobIndex] and keeps the rows
+    // displayTop5 shows with the sort figures; a query resultCache already
+    // holds is copied from it instead (returns true)
+    bool rankQuery(int jobIndex, const SkillId selectedIds[], const int weights[], int selectedCount, CachedResult &result);
 
     // Main process
     void searchAndMatch();
@@ -71,7 +131,9 @@ public:
     int getCandidateCount() const { return candCount; }
 };
 
-// Runner
-void runHRSystem();
+// Engine for the launcher
+Engine* createEngine();
+
+} // namespace insertion_binary_hr
 
 #endif // INSERTIONBINARY_HR_HPP
@@ -1,16 +1,45 @@
 #include "InsertionBinary_JobSeeker.hpp"
+#include "../../common/CsvLoader.hpp"
 #include <chrono>
 #include <algorithm>
 #include <iomanip>
 #include <limits>
 using namespace std::chrono;
 
+namespace insertion_binary_jobseeker {
+
 // ---------- Constructor ----------
 JobMatcher::JobMatcher() {
-    jobCount = 0;
+    jobJSs = nullptr;
+    skillPool = nullptr;
+    jobCount = jobCapacity = 0;
+    poolCount = poolCapacity = 0;
     seekerSkillCount = 0;
 }
 
+JobMatcher::~JobMatcher() {
+    delete[] jobJSs;
+    delete[] skillPool;
+}
+
+// ---------- Growable Stores ----------
+// Doubles capacity, moving the first count elements across
+template<typename T>
+static void grow(T*& data, int count, int &capacity) {
+    int newCapacity = capacity == 0 ? INITIAL_CAPACITY : capacity * 2;
+    T* newData = new T[newCapacity];
+    for (int i = 0; i < count; i++)
+        newData[i] = move(data[i]);
+    delete[] data;
+    data = newData;
+    capacity = newCapacity;
+}
+
+void JobMatcher::addSkill(SkillId id) {
+    if (poolCount == poolCapacity) grow(skillPool, poolCount, poolCapacity);
+    skillPool[poolCount++] = id;
+}
+
 // ---------- Trim Whitespace ----------
 string JobMatcher::trim(const string &s) {
     size_t start = s.find_first_not_of(" \t\r\n\"");
@@ -41,17 +70,15 @@ int JobMatcher::binarySearchJob(const string &title) {
 }
 
 // ---------- Binary Search Helper (for Skills) ----------
-bool JobMatcher::binarySearchSkill(string arr[], int n, string target) {
+bool JobMatcher::binarySearchSkill(const SkillId arr[], int n, SkillId target) {
     int left = 0, right = n - 1;
-    target = toLower(target);
 
     while (left <= right) {
         int mid = left + (right - left) / 2;
-        string midVal = toLower(arr[mid]);
 
-        if (midVal == target)
+        if (arr[mid] == target)
             return true;
-        else if (midVal < target)
+        else if (arr[mid] < target)
             left = mid + 1;
         else
             right = mid - 1;
@@ -60,72 +87,68 @@ bool JobMatcher::binarySearchSkill(string arr[], int n, string target) {
 }
 
 // ---------- Insertion Sort (Seeker Skills) ----------
+// Looks each skill up once and sorts the IDs; unknown skills become
+// INVALID_SKILL, which sorts last and never matches a job skill.
 void JobMatcher::insertionSortSkills() {
-    int indices[20];
-    for (int i = 0; i < seekerSkillCount; i++) indices[i] = i;
+    for (int i = 0; i < seekerSkillCount; i++)
+        seekerSkillIds[i] = SkillDictionary::global().find(seekerSkills[i]);
 
     for (int i = 1; i < seekerSkillCount; i++) {
-        int keyIndex = indices[i];
+        SkillId key = seekerSkillIds[i];
         int j = i - 1;
-        while (j >= 0 && toLower(seekerSkills[indices[j]]) > toLower(seekerSkills[keyIndex])) {
-            indices[j + 1] = indices[j];
+        while (j >= 0 && seekerSkillIds[j] > key) {
+            seekerSkillIds[j + 1] = seekerSkillIds[j];
             j--;
         }
-        indices[j + 1] = keyIndex;
+        seekerSkillIds[j + 1] = key;
     }
-
-    string sorted[20];
-    for (int i = 0; i < seekerSkillCount; i++)
-        sorted[i] = seekerSkills[indices[i]];
-
-    for (int i = 0; i < seekerSkillCount; i++)
-        seekerSkills[i] = sorted[i];
 }
 
 // ---------- Load Jobs from CSV ----------
-void JobMatcher::loadJobs(const string &filename) {
-    ifstream file(filename);
-    if (!file.is_open()) {
+bool JobMatcher::loadJobs(const string &filename) {
+    CsvReader reader(filename);
+    if (!reader.isOpen()) {
         cerr << "❌ Error: Cannot open file '" << filename << "'.\n";
-        exit(1);
+        return false;
     }
 
-    string line;
-    while (getline(file, line) && jobCount < 50) {
-        if (line.empty()) continue;
-
-        stringstream ss(line);
-        string title, dummy, skillLine;
-        getline(ss, title, ',');
-        getline(ss, dummy, '"');
-        getline(ss, skillLine, '"');
-
-        jobJSs[jobCount].title = toLower(trim(title));
-        if (jobJSs[jobCount].title.empty()) continue;
-
-        stringstream skillStream(skillLine);
-        string skill;
-        while (getline(skillStream, skill, ',') && jobJSs[jobCount].skillCount < 20) {
-            string trimmedSkill = trim(skill);
-            if (!trimmedSkill.empty())
-                jobJSs[jobCount].skills[jobJSs[jobCount].skillCount++] = trimmedSkill;
+    CsvRow row;
+    while (reader.next(row)) {
+        if (jobCount == jobCapacity) grow(jobJSs, jobCount, jobCapacity);
+        JobJS &job = jobJSs[jobCount];
+        job.title = toLower(string(row.key));
+        if (job.title.empty()) continue;
+
+        // A row with no known skill is dropped and its slot reused
+        job.skillStart = poolCount;
+        job.skillCount = 0;
+        SkillTokenizer tokens(row.skills);
+        string_view skill;
+        while (tokens.next(skill)) {
+            SkillId id = SkillDictionary::global().intern(skill);
+            if (id != INVALID_SKILL) {
+                addSkill(id);
+                job.skillCount++;
+            }
         }
 
-        if (jobJSs[jobCount].skillCount > 0)
+        if (job.skillCount > 0) {
+            job.hasProfile = SkillBitset::buildPositionalQuery(skillsOf(job), job.skillCount, job.profile);
             jobCount++;
+        }
     }
-    file.close();
 
     // Sort jobs by title alphabetically for binary search
     for (int i = 1; i < jobCount; ++i) {
-        JobJS key = jobJSs[i];
+        JobJS key = move(jobJSs[i]);
         int j = i - 1;
         while (j >= 0 && jobJSs[j].title > key.title) {
-            jobJSs[j + 1] = jobJSs[j];
+            jobJSs[j + 1] = move(jobJSs[j]);
             j--;
         }
-        jobJSs[j + 1] = key;
+        jobJSs[j + 1] = move(key);
     }
+    return true;
 }
 
 // ---------- Input Seeker Skills ----------
@@ -151,6 +174,16 @@ void JobMatcher::inputSeekerSkills() {
     }
 }
 
+// ---------- Set Seeker Skills ----------
+// Same rules as inputSeekerSkills: at most 20, blanks skipped
+void JobMatcher::setSeekerSkills(const string skills[], int count) {
+    seekerSkillCount = 0;
+    for (int i = 0; i < count && seekerSkillCount < 20; i++) {
+        string skill = trim(skills[i]);
+        if (!skill.empty()) seekerSkills[seekerSkillCount++] = skill;
+    }
+}
+
 // ---------- Getter for individual seeker skill ----------
 string JobMatcher::getSeekerSkillAt(int index) const {
     if (index < 0 || index >= seekerSkillCount) return "";
@@ -161,15 +194,24 @@ string JobMatcher::getSeekerSkillAt(int index) const {
 void JobMatcher::matchSkillsWeighted() {
     insertionSortSkills();
 
+    // Bitset of the seeker's skills for popcount scoring
+    bool useBitset = SkillBitset::vocabularyFits();
+    SkillMask seekerMask = SkillBitset::maskOf(seekerSkillIds, seekerSkillCount);
+
     for (int i = 0; i < jobCount; i++) {
         jobJSs[i].matched = 0;
         jobJSs[i].weightedScore = 0;
 
-        for (int j = 0; j < jobJSs[i].skillCount; j++) {
-            int weight = jobJSs[i].skillCount - j;
-            if (binarySearchSkill(seekerSkills, seekerSkillCount, jobJSs[i].skills[j])) {
-                jobJSs[i].matched++;
-                jobJSs[i].weightedScore += weight;
+        if (useBitset && jobJSs[i].hasProfile) {
+            SkillBitset::score(seekerMask, jobJSs[i].profile, jobJSs[i].matched, jobJSs[i].weightedScore);
+        } else {
+            const SkillId* skills = skillsOf(jobJSs[i]);
+            for (int j = 0; j < jobJSs[i].skillCount; j++) {
+                int weight = jobJSs[i].skillCount - j;
+                if (binarySearchSkill(seekerSkillIds, seekerSkillCount, skills[j])) {
+                    jobJSs[i].matched++;
+                    jobJSs[i].weightedScore += weight;
+                }
             }
         }
 
@@ -184,6 +226,16 @@ JobJS JobMatcher::getJobAt(int index) const {
     return jobJSs[index];
 }
 
+// ---------- Collect Matched Jobs ----------
+int JobMatcher::collectMatches(JobJS out[]) const {
+    int matchedCount = 0;
+    for (int i = 0; i < jobCount; i++) {
+        if (jobJSs[i].weightedScore > 0)
+            out[matchedCount++] = jobJSs[i];
+    }
+    return matchedCount;
+}
+
 // ---------- Static: Sort jobs by weighted score using indices ----------
 void JobMatcher::sortJobsByWeightedScoreArray(JobJS arr[], int count) {
     for (int i = 1; i < count; i++) {
@@ -197,8 +249,50 @@ void JobMatcher::sortJobsByWeightedScoreArray(JobJS arr[], int count) {
     }
 }
 
+// ---------- Static: Counting sort by weighted score ----------
+// Same order as sortJobsByWeightedScoreArray in O(n + W)
+void JobMatcher::countingSortJobsArray(JobJS arr[], int count) {
+    uint64_t* keys = new uint64_t[count > 0 ? count : 1];
+    int* order = new int[count > 0 ? count : 1];
+    for (int i = 0; i < count; i++) keys[i] = arr[i].weightedScore;
+    CountingRank::rank(keys, count, order);
+
+    JobJS* ranked = new JobJS[count > 0 ? count : 1];
+    for (int i = 0; i < count; i++) ranked[i] = move(arr[order[i]]);
+    for (int i = 0; i < count; i++) arr[i] = move(ranked[i]);
+    delete[] ranked;
+    delete[] order;
+    delete[] keys;
+}
+
+// ---------- Static: Top-K jobs by weighted score ----------
+// Same order as sortJobsByWeightedScoreArray, but only the first k slots are ranked
+void JobMatcher::selectTopJobsArray(JobJS arr[], int count, int k) {
+    auto better = [&](int a, int b) { return arr[a].weightedScore > arr[b].weightedScore; };
+    TopK<int, decltype(better)> top(k, better);
+    for (int i = 0; i < count; i++)
+        top.push(i);
+
+    int order[TOP_JOBS];
+    JobJS picked[TOP_JOBS];
+    int kept = top.take(order);
+    for (int i = 0; i < kept; i++) picked[i] = arr[order[i]];
+    for (int i = 0; i < kept; i++) arr[i] = picked[i];
+}
+
+// ---------- Static: Rank matched jobs ----------
+void JobMatcher::rankJobsArray(JobJS arr[], int count) {
+    if (Ranking::selectTop(TOP_JOBS, count))
+        selectTopJobsArray(arr, count, TOP_JOBS);
+    else if (Ranking::counting())
+        countingSortJobsArray(arr, count);
+    else
+        sortJobsByWeightedScoreArray(arr, count);
+}
+
 // ---------- Static: Display Top Matches ----------
 void JobMatcher::displayTopMatchesArray(JobJS arr[], int count) {
+    AllocScope displaying(ALLOC_DISPLAY);
     cout << "\nTop 3 Best-Matching Jobs (Weighted Scoring):\n";
     cout << left << setw(30) << "Job Title"
          << setw(12) << "Matched"
@@ -206,7 +300,7 @@ void JobMatcher::displayTopMatchesArray(JobJS arr[], int count) {
          << setw(12) << "Percentage" << endl;
     cout << string(70, '-') << endl;
 
-    int limit = (count < 3) ? count : 3;
+    int limit = (count < TOP_JOBS) ? count : TOP_JOBS;
     int validCount = 0;
     for (int i = 0; i < limit; i++) {
         if (arr[i].weightedScore > 0) {
@@ -222,42 +316,38 @@ void JobMatcher::displayTopMatchesArray(JobJS arr[], int count) {
 }
 
 // ---------- Main Runner ----------
-void runJobSeekerSystem() {
+void runJobSeekerSystem(JobMatcher &jm) {
     cout << "==============================================" << endl;
     cout << "        JOB SEEKER MATCHING SYSTEM" << endl;
     cout << "==============================================" << endl;
 
-    JobMatcher jm;
-    jm.loadJobs("job_description/mergejob.csv");
-
     bool running = true;
     auto systemStart = chrono::high_resolution_clock::now();
 
     while (running) {
         jm.inputSeekerSkills();
 
+        MemoryPhase matchMemory(ALLOC_SEARCH);
+        matchMemory.start();
         auto startMatch = chrono::high_resolution_clock::now();
         jm.matchSkillsWeighted();
         auto endMatch = chrono::high_resolution_clock::now();
-
-        // Use indices to reduce memory for matched jobs
-        int matchedIndices[50];
-        int matchedJobCount = 0;
-        for (int i = 0; i < jm.getJobCount(); i++) {
-            if (jm.getJobAt(i).weightedScore > 0)
-                matchedIndices[matchedJobCount++] = i;
-        }
+        matchMemory.stop();
 
         // Sort matched jobs by weighted score
-        JobJS sortedMatches[50];
-        for (int i = 0; i < matchedJobCount; i++)
-            sortedMatches[i] = jm.getJobAt(matchedIndices[i]);
+        int jobCount = jm.getJobCount();
+        JobJS* sortedMatches = new JobJS[jobCount > 0 ? jobCount : 1];
+        int matchedJobCount = jm.collectMatches(sortedMatches);
 
+        MemoryPhase sortMemory(ALLOC_SORT);
+        sortMemory.start();
         auto startSort = chrono::high_resolution_clock::now();
-        JobMatcher::sortJobsByWeightedScoreArray(sortedMatches, matchedJobCount);
+        JobMatcher::rankJobsArray(sortedMatches, matchedJobCount);
         auto endSort = chrono::high_resolution_clock::now();
+        sortMemory.stop();
 
         JobMatcher::displayTopMatchesArray(sortedMatches, matchedJobCount);
+        delete[] sortedMatches;
 
         double matchTime = chrono::duration<double, milli>(endMatch - startMatch).count();
         double sortTime = chrono::duration<double, milli>(endSort - startSort).count();
@@ -279,18 +369,16 @@ void runJobSeekerSystem() {
                 backToSkill = true;
                 break;
             } else if (choice == 2) {
-                size_t skillMem = jm.getSeekerSkillCount() * sizeof(string);
-                size_t jobMem = matchedJobCount * sizeof(JobJS);
-                size_t baseMem = sizeof(jm);
-
                 cout << "\n=============================\n";
                 cout << "Performance Summary\n";
                 cout << "=============================\n";
                 cout << "Skill Matching (Binary) Time : " << fixed << setprecision(3) << matchTime << " ms\n";
-                cout << "Skill Matching Memory        : " << fixed << setprecision(3) << (skillMem / 1024.0) << " KB\n";
+                cout << "Skill Matching Memory        : " << fixed << setprecision(3) << matchMemory.heapDeltaKB() << " KB\n";
                 cout << "Insertion Sort Time          : " << fixed << setprecision(3) << sortTime << " ms\n";
-                cout << "Insertion Sort Memory        : " << fixed << setprecision(3) << (jobMem / 1024.0) << " KB\n";
-                // cout << "Approx. Base Memory (JobMatcher object) : " << fixed << setprecision(3) << (baseMem / 1024.0) << " KB\n";
+                cout << "Insertion Sort Memory        : " << fixed << setprecision(3) << sortMemory.heapDeltaKB() << " KB\n";
+                cout << "Process RSS                  : " << MemoryStats::currentRssKB() << " KB\n";
+                cout << "Peak RSS                     : " << MemoryStats::peakRssKB() << " KB\n";
+                AllocStats::printReport();
             } else if (choice == 3) {
                 running = false;
                 backToSkill = false;
@@ -310,7 +398,40 @@ void runJobSeekerSystem() {
     cout << "Total session runtime: " << fixed << setprecision(3) << totalSystemTime << " ms\n";
 }
 
-int main() {
-    runJobSeekerSystem();
-    return 0;
+// ---------- Engine ----------
+class InsertionBinaryJobSeekerEngine : public Engine {
+private:
+    JobMatcher jm;
+
+public:
+    const char* name() const override { return "Array Insertion Sort and Binary Search (Job Seeker)"; }
+
+    bool loadFrom(const string &jobsFile, const string &) override { return jm.loadJobs(jobsFile); }
+
+    void query() override { runJobSeekerSystem(jm); }
+
+    int recordCount() const override { return jm.getJobCount(); }
+
+    bool runQuery(const EngineQuery &query) override {
+        jm.setSeekerSkills(query.skills, query.skillCount);
+        jm.matchSkillsWeighted();
+
+        int jobCount = jm.getJobCount();
+        JobJS* matches = new JobJS[jobCount > 0 ? jobCount : 1];
+        int matchedCount = jm.collectMatches(matches);
+        JobMatcher::rankJobsArray(matches, matchedCount);
+        delete[] matches;
+        return true;
+    }
+};
+
+Engine* createEngine() { return new InsertionBinaryJobSeekerEngine(); }
+
+} // namespace insertion_binary_jobseeker
+
+#ifndef ENGINE_NO_MAIN
+int main(int argc, char* argv[]) {
+    Ranking::configure(Ranking::modeFromArgs(argc, argv));
+    return runEngine(insertion_binary_jobseeker::createEngine());
 }
+#endif
@@ -8,53 +8,89 @@
 #include <iomanip>
 #include <algorithm>
 #include <limits>
+#include "../../common/SkillDictionary.hpp"
+#include "../../common/SkillBitset.hpp"
+#include "../../common/TopK.hpp"
+#include "../../common/CountingRank.hpp"
+#include "../../common/MemoryStats.hpp"
+#include "../../common/Engine.hpp"
 using namespace std;
 
+namespace insertion_binary_jobseeker {
+
+const int TOP_JOBS = 3;           // rows in the Top 3 table
+const int INITIAL_CAPACITY = 64;  // first size of each growable store
+
 // ---------- Struct for Job ----------
+// Skills are a run of JobMatcher's skill pool, read through skillsOf()
 struct JobJS {
     string title;
-    string skills[20];
+    int skillStart = 0;
     int skillCount = 0;
+    WeightedQuery profile;     // positional skill weights as bit planes
+    bool hasProfile = false;
     int matched = 0;
     int weightedScore = 0;
     double percentage = 0.0;
 };
 
 // ---------- Job Matching System (Class) ----------
+// Jobs are held in heap stores that double when full, so the input size
+// alone decides how many are loaded.
 class JobMatcher {
 private:
-    JobJS jobJSs[50];
-    int jobCount;
+    JobJS* jobJSs;
+    SkillId* skillPool;       // every job's skills, back to back
+    int jobCount, jobCapacity;
+    int poolCount, poolCapacity;
     string seekerSkills[20];
+    SkillId seekerSkillIds[20];  // sorted IDs of seekerSkills
     int seekerSkillCount;
 
     // Utility
     string trim(const string &s);
     string toLower(string str);
+    void addSkill(SkillId id);
 
 public:
     // Constructor
     JobMatcher();
+    ~JobMatcher();
+
+    JobMatcher(const JobMatcher&) = delete;
+    JobMatcher& operator=(const JobMatcher&) = delete;
+
+    const SkillId* skillsOf(const JobJS &job) const { return skillPool + job.skillStart; }
 
     // Core functions
-    void loadJobs(const string &filename);
+    bool loadJobs(const string &filename);   // false when the file cannot be opened
     void inputSeekerSkills();
+    void setSeekerSkills(const string skills[], int count);   // non-interactive inputSeekerSkills
     void matchSkillsWeighted();
     void insertionSortSkills();
 
     // Searching
     int binarySearchJob(const string &title);
-    bool binarySearchSkill(string arr[], int n, string target);
+    bool binarySearchSkill(const SkillId arr[], int n, SkillId target);
 
     // Getters
     int getJobCount() const { return jobCount; }
     int getSeekerSkillCount() const { return seekerSkillCount; }
     JobJS getJobAt(int index) const; // return a copy of job at index
     string getSeekerSkillAt(int index) const; // <-- ADD THIS
+    int collectMatches(JobJS out[]) const;    // copies jobs with a score into out (room for getJobCount())
 
     // Static helpers operating on arrays of JobJS (used for matched jobs)
     static void sortJobsByWeightedScoreArray(JobJS arr[], int count);
+    static void countingSortJobsArray(JobJS arr[], int count);
+    static void selectTopJobsArray(JobJS arr[], int count, int k);
+    static void rankJobsArray(JobJS arr[], int count);   // top-K, insertion or counting sort, as the session does
     static void displayTopMatchesArray(JobJS arr[], int count);
 };
 
+// Engine for the launcher
+Engine* createEngine();
+
+} // namespace insertion_binary_jobseeker
+
 #endif // INSERTIONBINARY_JOBSEEKER_HPP
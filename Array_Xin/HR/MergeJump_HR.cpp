@@ -1,5 +1,7 @@
 #include "MergeJump_HR.hpp"
 
+namespace merge_jump_hr {
+
 // ====================== Common Function Implementations ======================
 string toLower(const string &str) {
     string result = str;
@@ -13,23 +15,39 @@ string trim(const string &s) {
     return (start == string::npos) ? "" : s.substr(start, end - start + 1);
 }
 
-DynamicArray<string> splitSkills(const string &line) {
-    DynamicArray<string> skills;
-    stringstream ss(line);
-    string skill;
-    while (getline(ss, skill, ',')) {
-        skill = trim(skill);
-        if (!skill.empty()) skills.push_back(toLower(skill));
-    }
+// Sorts the IDs so jumpSearch can probe them
+static void sortSkillIds(DynamicArray<SkillId> &skills) {
     for (int i = 0; i < skills.getSize() - 1; i++) {
         for (int j = 0; j < skills.getSize() - i - 1; j++) {
             if (skills[j] > skills[j + 1]) swap(skills[j], skills[j + 1]);
         }
     }
+}
+
+// Interns each skill and sorts the IDs
+DynamicArray<SkillId> splitSkills(string_view line) {
+    DynamicArray<SkillId> skills;
+    SkillTokenizer tokens(line);
+    string_view skill;
+    while (tokens.next(skill)) {
+        SkillId id = SkillDictionary::global().intern(skill);
+        if (id != INVALID_SKILL) skills.push_back(id);
+    }
+    sortSkillIds(skills);
     return skills;
 }
 
-bool jumpSearch(const DynamicArray<string> &arr, const string &target) {
+// Job skills are listed to the user, so keep them in alphabetical order
+static void sortSkillsByName(DynamicArray<SkillId> &skills) {
+    const SkillDictionary &dict = SkillDictionary::global();
+    for (int i = 0; i < skills.getSize() - 1; i++) {
+        for (int j = 0; j < skills.getSize() - i - 1; j++) {
+            if (dict.key(skills[j]) > dict.key(skills[j + 1])) swap(skills[j], skills[j + 1]);
+        }
+    }
+}
+
+bool jumpSearch(const DynamicArray<SkillId> &arr, SkillId target) {
     int n = arr.getSize();
     if (n == 0) return false;
     int step = sqrt(n);
@@ -45,51 +63,352 @@ bool jumpSearch(const DynamicArray<string> &arr, const string &target) {
     return false;
 }
 
+SkillMask skillMaskOf(const DynamicArray<SkillId> &skills) {
+    SkillMask mask = 0;
+    for (int i = 0; i < skills.getSize(); i++) SkillBitset::addSkill(mask, skills[i]);
+    return mask;
+}
+
+// Maps candidates.bin when the cleaner wrote one, parses the CSV otherwise
 DynamicArray<Candidate> readCandidates(const string &filename) {
     DynamicArray<Candidate> candidates;
-    ifstream file(filename);
-    string line;
-    while (getline(file, line)) {
-        if (line.empty()) continue;
-        size_t commaPos = line.find(',');
-        if (commaPos == string::npos) continue;
-        string name = trim(line.substr(0, commaPos));
-        string skillsStr = line.substr(commaPos + 1);
-        Candidate c{ name, splitSkills(skillsStr) };
-        candidates.push_back(c);
+    RecordReader reader(filename);
+    candidates.reserve(reader.expectedRecords());
+    string_view name;
+    const SkillId* ids;
+    int idCount;
+    while (reader.next(name, ids, idCount)) {
+        // Built in its slot: no Candidate or skill array is ever copied
+        Candidate &c = candidates.emplace_back();
+        c.name.assign(name);
+        c.skills.reserve(idCount);
+        for (int k = 0; k < idCount; k++) c.skills.push_back(ids[k]);
+        sortSkillIds(c.skills);
+        c.mask = skillMaskOf(c.skills);
     }
+    candidates.shrink_to_fit();   // a CSV's line count can overshoot
     return candidates;
 }
 
 DynamicArray<Job> readJobs(const string &filename) {
     DynamicArray<Job> jobs;
-    ifstream file(filename);
-    string line;
-    while (getline(file, line)) {
-        if (line.empty()) continue;
-        size_t commaPos = line.find(',');
-        if (commaPos == string::npos) continue;
-        string title = trim(line.substr(0, commaPos));
-        string skillsStr = line.substr(commaPos + 1);
-        Job j{ title, splitSkills(skillsStr) };
-        jobs.push_back(j);
+    CsvReader reader(filename);
+    jobs.reserve(reader.remainingLines());
+    CsvRow row;
+    while (reader.next(row)) {
+        Job &j = jobs.emplace_back();
+        j.title.assign(row.key);
+        j.key = CsvReader::normalizeKey(row.key);
+        j.skills = splitSkills(row.skills);
+        j.hasProfile = false;
+        sortSkillsByName(j.skills);
     }
+    jobs.shrink_to_fit();
     return jobs;
 }
 
-size_t getCurrentMemoryUsageKB() {
-            PROCESS_MEMORY_COUNTERS_EX pmc;
-            GetProcessMemoryInfo(GetCurrentProcess(), (PROCESS_MEMORY_COUNTERS*)&pmc, sizeof(pmc));
-            return pmc.WorkingSetSize / 1024; // Convert bytes → KB
+// ====================== Matching ======================
+const int TOP_MATCHES = 5;        // rows in the Top 5 table
+const int MAX_QUERY_SKILLS = 20;  // skills runQuery() passes through
+
+void buildScoringIndex(const DynamicArray<Candidate> &candidates, ScoringIndex &index) {
+    int n = candidates.getSize();
+    index.candidateMasks.reserve(n);
+    index.hits.reserve(n);
+    index.scoredSkills.reserve(n);
+    index.scoredWeight.reserve(n);
+    for (int i = 0; i < candidates.getSize(); i++) {
+        index.candidateMasks.push_back(candidates[i].mask);
+        for (int k = 0; k < candidates[i].skills.getSize(); k++)
+            index.skillIndex.add(i, candidates[i].skills[k]);
+        index.hits.push_back(0);
+        index.scoredSkills.push_back(0);
+        index.scoredWeight.push_back(0);
+    }
+    index.skillIndex.build(candidates.getSize());
+    index.cache.clear();
+    index.matchesUnlisted = false;
+    index.results.invalidate();
+}
+
+// Lists candidate i in index.cache; its hit mask is only built here when the
+// skills have no mask bits, rescore() derives it from candidateMasks otherwise
+static void recordMatch(const DynamicArray<Candidate> &candidates, ScoringIndex &index, int i) {
+    if (index.cache.usesSkillMasks()) {
+        index.cache.add(i);
+        return;
+    }
+    SkillMask hitMask = 0;
+    for (int k = 0; k < candidates[i].skills.getSize(); k++)
+        hitMask |= index.cache.slotOf(candidates[i].skills[k]);
+    index.cache.add(i, hitMask);
+}
+
+int searchCandidates(const DynamicArray<Candidate> &candidates, ScoringIndex &index,
+                     const DynamicArray<SkillId> &chosenSkills, const DynamicArray<int> &skillWeights,
+                     DynamicArray<CandidateMatch> &matches, bool &ranked) {
+    int totalPossibleWeight = 0;
+    for (int i = 0; i < skillWeights.getSize(); i++) totalPossibleWeight += skillWeights[i];
+
+    // Same skills as the last search, only the weights changed: rescore the
+    // cached matches instead of searching again. A top-K scan leaves its
+    // matches unlisted, scored by ordinal in scoredWeight, and they are only
+    // listed here once a weight change asks for them.
+    MatchCache &cache = index.cache;
+    if (index.matchesUnlisted && cache.recording() &&
+        cache.repeats(&chosenSkills[0], chosenSkills.getSize())) {
+        cache.reserve(index.unlistedCount);
+        for (int i = 0; i < candidates.getSize(); i++)
+            if (index.scoredWeight[i] > 0) recordMatch(candidates, index, i);
+        cache.finish();
+    }
+    index.matchesUnlisted = false;
+    if (cache.rescore(&chosenSkills[0], &skillWeights[0], chosenSkills.getSize(), &index.candidateMasks[0])) {
+        auto addMatch = [&](int k) {
+            CandidateMatch cm;
+            cm.name = candidates[cache.candidate(k)].name;
+            cm.matchedSkills = cache.matchedSkills(k);
+            cm.matchedWeight = cache.matchedWeight(k);
+            cm.score = (double)cm.matchedWeight / totalPossibleWeight;
+            matches.push_back(move(cm));
+        };
+        // As in the full scan, only the table's rows are copied when top-K
+        // selection decides it
+        if (Ranking::selectTop(TOP_MATCHES, cache.size())) {
+            auto better = [&](int a, int b) { return cache.matchedWeight(a) > cache.matchedWeight(b); };
+            TopK<int, decltype(better)> top(TOP_MATCHES, better);
+            for (int k = 0; k < cache.size(); k++) top.push(k);
+
+            int order[TOP_MATCHES];
+            int kept = top.take(order);
+            for (int k = 0; k < kept; k++) addMatch(order[k]);
+            ranked = true;
+            return cache.size();
         }
+        matches.reserve(cache.size());
+        for (int k = 0; k < cache.size(); k++) addMatch(k);
+        ranked = false;
+        return cache.size();
+    }
+    bool record = cache.begin(&chosenSkills[0], &skillWeights[0], chosenSkills.getSize());
+
+    // Posting lists for rare skills; otherwise ScoringKernel over the mask
+    // array when every skill has a bit, jump search as the last resort
+    WeightedQuery query;
+    bool useIndex = index.skillIndex.isSelective(&chosenSkills[0], chosenSkills.getSize());
+    bool useBitset = SkillBitset::vocabularyFits() &&
+                     SkillBitset::buildQuery(&chosenSkills[0], &skillWeights[0], chosenSkills.getSize(), query);
+
+    // Full scans run chunked on the thread pool, each chunk keeping its own
+    // top K; when that already decides the table, only those K are copied
+    int visitCount = candidates.getSize();
+    int matchCount = 0;
+    ranked = false;
+    if (useIndex) {
+        visitCount = index.skillIndex.query(&chosenSkills[0], &skillWeights[0], chosenSkills.getSize(),
+                                            &index.hits[0], &index.scoredSkills[0], &index.scoredWeight[0]);
+    } else {
+        auto scoreRange = [&](int begin, int end) {
+            if (useBitset) {
+                ScoringKernel::score(&index.candidateMasks[begin], end - begin, query,
+                                     &index.scoredSkills[begin], &index.scoredWeight[begin]);
+                return;
+            }
+            for (int i = begin; i < end; i++) {
+                index.scoredSkills[i] = index.scoredWeight[i] = 0;
+                for (int j = 0; j < chosenSkills.getSize(); j++) {
+                    if (jumpSearch(candidates[i].skills, chosenSkills[j])) {
+                        index.scoredSkills[i]++;
+                        index.scoredWeight[i] += skillWeights[j];
+                    }
+                }
+            }
+        };
+        // score is matchedWeight / totalPossibleWeight, so weight alone orders them
+        auto isMatch = [&](int i) { return index.scoredWeight[i] > 0; };
+        auto better = [&](int a, int b) { return index.scoredWeight[a] > index.scoredWeight[b]; };
+
+        int order[TOP_MATCHES];
+        int kept = parallelTopK(ThreadPool::global(), candidates.getSize(), TOP_MATCHES,
+                                scoreRange, isMatch, better, order, matchCount);
+        if (Ranking::selectTop(TOP_MATCHES, matchCount)) {
+            for (int k = 0; k < kept; k++) {
+                int i = order[k];
+                CandidateMatch cm;
+                cm.name = candidates[i].name;
+                cm.matchedSkills = index.scoredSkills[i];
+                cm.matchedWeight = index.scoredWeight[i];
+                cm.score = (double)index.scoredWeight[i] / totalPossibleWeight;
+                matches.push_back(move(cm));
+            }
+            ranked = true;
+        }
+    }
+
+    for (int v = 0; v < visitCount && !ranked; v++) {
+        int i = useIndex ? index.hits[v] : v;
+        if (index.scoredWeight[v] > 0) {
+            CandidateMatch cm;
+            cm.name = candidates[i].name;
+            cm.matchedSkills = index.scoredSkills[v];
+            cm.matchedWeight = index.scoredWeight[v];
+            cm.score = (double)index.scoredWeight[v] / totalPossibleWeight;
+            matches.push_back(move(cm));
+            if (record) recordMatch(candidates, index, i);
+        }
+    }
+
+    // The top-K scan above listed no matches: the recording stays open
+    // until a weight change needs it
+    if (ranked && record) {
+        index.matchesUnlisted = true;
+        index.unlistedCount = matchCount;
+    } else {
+        cache.finish();
+    }
+
+    return ranked ? matchCount : matches.getSize();
+}
+
+// Sort by matchedWeight (descending)
+static void mergeMatches(DynamicArray<CandidateMatch>& arr, int left, int mid, int right) {
+    int n1 = mid - left + 1;
+    int n2 = right - mid;
+
+    CandidateMatch* L = new CandidateMatch[n1];
+    CandidateMatch* R = new CandidateMatch[n2];
+
+    for (int i = 0; i < n1; i++) L[i] = move(arr[left + i]);
+    for (int j = 0; j < n2; j++) R[j] = move(arr[mid + 1 + j]);
+
+    int i = 0, j = 0, k = left;
+
+    // Sort by matchedWeight (desc), tie-break by score; the left run wins
+    // full ties, so equal candidates keep load order as in the top-K path
+    while (i < n1 && j < n2) {
+        if (!(R[j].matchedWeight > L[i].matchedWeight ||
+              (R[j].matchedWeight == L[i].matchedWeight && R[j].score > L[i].score))) {
+            arr[k++] = move(L[i++]);
+        } else {
+            arr[k++] = move(R[j++]);
+        }
+    }
+
+    while (i < n1) arr[k++] = move(L[i++]);
+    while (j < n2) arr[k++] = move(R[j++]);
+
+    delete[] L;
+    delete[] R;
+}
+
+static void mergeSortMatches(DynamicArray<CandidateMatch>& arr, int left, int right) {
+    if (left < right) {
+        int mid = left + (right - left) / 2;
+        mergeSortMatches(arr, left, mid);
+        mergeSortMatches(arr, mid + 1, right);
+        mergeMatches(arr, left, mid, right);
+    }
+}
+
+// Stable counting sort in mergeMatches' order, on matchedWeight. score is
+// that weight over the query's total, so it never breaks a tie the weight
+// leaves.
+static void countingSortMatches(DynamicArray<CandidateMatch>& arr) {
+    int n = arr.getSize();
+    uint64_t* keys = new uint64_t[n];
+    int* order = new int[n];
+    for (int i = 0; i < n; i++) keys[i] = arr[i].matchedWeight;
+    CountingRank::rank(keys, n, order);
+
+    DynamicArray<CandidateMatch> ranked;
+    ranked.reserve(n);
+    for (int i = 0; i < n; i++) ranked.push_back(move(arr[order[i]]));
+    arr = move(ranked);
+
+    delete[] keys;
+    delete[] order;
+}
+
+// Top-K selection when only a few rows are shown, merge sort otherwise;
+// the ranking mode can force either sort
+void rankMatches(DynamicArray<CandidateMatch> &matches, bool ranked) {
+    if (ranked) {
+        // already merged from the per-chunk top K during the search
+    } else if (Ranking::selectTop(TOP_MATCHES, matches.getSize())) {
+        auto better = [&](int a, int b) {
+            return matches[a].matchedWeight > matches[b].matchedWeight ||
+                   (matches[a].matchedWeight == matches[b].matchedWeight && matches[a].score > matches[b].score);
+        };
+        TopK<int, decltype(better)> top(TOP_MATCHES, better);
+        for (int i = 0; i < matches.getSize(); i++) top.push(i);
+
+        int order[TOP_MATCHES];
+        CandidateMatch picked[TOP_MATCHES];
+        int kept = top.take(order);
+        for (int i = 0; i < kept; i++) picked[i] = matches[order[i]];
+        for (int i = 0; i < kept; i++) matches[i] = picked[i];
+    } else if (Ranking::counting()) {
+        countingSortMatches(matches);
+    } else if (matches.getSize() > 1) {
+        mergeSortMatches(matches, 0, matches.getSize() - 1);
+    }
+}
+
+bool rankQuery(const string &jobKey, const DynamicArray<Candidate> &candidates, ScoringIndex &index,
+               const DynamicArray<SkillId> &chosenSkills, const DynamicArray<int> &skillWeights,
+               CachedResult &result) {
+    string key = QueryCache::keyOf(jobKey, &chosenSkills[0], &skillWeights[0], chosenSkills.getSize());
+    const CachedResult* cached = index.results.find(key);
+    if (cached) {
+        result = *cached;
+        return true;
+    }
+    result = CachedResult();
+
+    // =====================================
+    // SEARCH PHASE
+    // =====================================
+    // --- Track memory/time before searching ---
+    MemoryPhase searchMemory(ALLOC_SEARCH);
+    searchMemory.start();
+    auto searchStartTime = high_resolution_clock::now();
+
+    DynamicArray<CandidateMatch> matches;
+    bool ranked;
+    result.matchedCount = searchCandidates(candidates, index, chosenSkills, skillWeights, matches, ranked);
+
+    auto searchEndTime = high_resolution_clock::now();
+    result.searchTimeMS = duration<double, milli>(searchEndTime - searchStartTime).count();
+    searchMemory.stop();
+    result.searchMemoryBytes = searchMemory.heapDeltaBytes();
+
+    // =====================================
+    // SORT PHASE
+    // =====================================
+
+    // --- Track memory/time before sorting ---
+    MemoryPhase sortMemory(ALLOC_SORT);
+    sortMemory.start();
+    auto sortStartTime = high_resolution_clock::now();
+
+    rankMatches(matches, ranked);
+
+    // --- End of sort section ---
+    auto sortEndTime = high_resolution_clock::now();
+    result.sortTimeMS = duration<double, milli>(sortEndTime - sortStartTime).count();
+    sortMemory.stop();
+    result.sortMemoryBytes = sortMemory.heapDeltaBytes();
+
+    for (int i = 0; i < matches.getSize() && i < TOP_MATCHES; i++)
+        result.addRow(matches[i].name, matches[i].matchedSkills, matches[i].matchedWeight, matches[i].score);
+    index.results.store(key, result);
+    return false;
+}
 
 // ====================== Employer Mode ======================
-void employerMode(const DynamicArray<Job> &jobs, const DynamicArray<Candidate> &candidates) {
+void employerMode(const DynamicArray<Job> &jobs, const DynamicArray<Candidate> &candidates, ScoringIndex &index) {
     bool continueProgram = true;
     while (continueProgram) {
-        auto start = high_resolution_clock::now();
-        size_t initialMemory = getCurrentMemoryUsageKB();
-
         cout << "\n==================================\n";
         cout << "     HR Job Matching System\n";
         cout << "==================================\n";
@@ -116,10 +435,11 @@ void employerMode(const DynamicArray<Job> &jobs, const DynamicArray<Candidate> &
         }
         cin.ignore();
 
+        const SkillDictionary &dict = SkillDictionary::global();
         Job selectedJob = jobs[jobChoice - 1];
         cout << "\nRole: " << selectedJob.title << "\nRequired Skills:\n";
         for (int i = 0; i < selectedJob.skills.getSize(); i++) {
-            cout << " " << i + 1 << ". " << selectedJob.skills[i] << "\n";
+            cout << " " << i + 1 << ". " << dict.key(selectedJob.skills[i]) << "\n";
         }
 
         int numSkills;
@@ -141,7 +461,7 @@ void employerMode(const DynamicArray<Job> &jobs, const DynamicArray<Candidate> &
             }
         }
 
-        DynamicArray<string> chosenSkills;
+        DynamicArray<SkillId> chosenSkills;
         DynamicArray<int> skillWeights;
 
         for (int i = 0; i < numSkills; i++) {
@@ -171,7 +491,7 @@ void employerMode(const DynamicArray<Job> &jobs, const DynamicArray<Candidate> &
         for (int i = 0; i < numSkills; i++) {
             int weight;
             while (true) {
-                cout << "Weight for \"" << chosenSkills[i] << "\": ";
+                cout << "Weight for \"" << dict.key(chosenSkills[i]) << "\": ";
 
                 if (cin >> weight) { 
                     cin.ignore();
@@ -190,122 +510,10 @@ void employerMode(const DynamicArray<Job> &jobs, const DynamicArray<Candidate> &
             }
         }
 
-        int totalPossibleWeight = 0;
-        for (int i = 0; i < skillWeights.getSize(); i++) totalPossibleWeight += skillWeights[i];
-
-        // =====================================
-        // SEARCH PHASE
-        // =====================================
-        // --- Track memory/time before searching ---
-        size_t searchStartMem = getCurrentMemoryUsageKB();
-        auto searchStartTime = high_resolution_clock::now();
-
-        // Compute weighted matching
-        struct CandidateMatch {
-            string name;
-            int matchedSkills;
-            int matchedWeight;
-            double score;
-        };
-
-        DynamicArray<CandidateMatch> matches;
-
-        for (int i = 0; i < candidates.getSize(); i++) {
-            int matchedSkills = 0;
-            int matchedWeight = 0;
-
-            for (int j = 0; j < chosenSkills.getSize(); j++) {
-                if (jumpSearch(candidates[i].skills, chosenSkills[j])) {
-                    matchedSkills++;
-                    matchedWeight += skillWeights[j];
-                }
-            }
-
-            if (matchedWeight > 0) {
-                CandidateMatch cm;
-                cm.name = candidates[i].name;
-                cm.matchedSkills = matchedSkills;
-                cm.matchedWeight = matchedWeight;
-                cm.score = (double)matchedWeight / totalPossibleWeight;
-                matches.push_back(cm);
-            }
-        }
-
-        auto searchEndTime = high_resolution_clock::now();
-        double searchTime = duration<double, milli>(searchEndTime - searchStartTime).count();
-
-        size_t searchMemoryUsed = sizeof(string) * chosenSkills.getSize()        // list of searched skills
-                                + sizeof(string) * candidates.getSize() * 0.1    // small fraction of candidate list in memory
-                                + sizeof(int) * 5;  
-
-        // =====================================
-        // SORT PHASE
-        // =====================================
-
-        // --- Track memory/time before sorting ---
-        size_t sortStartMem = getCurrentMemoryUsageKB();
-        auto sortStartTime = high_resolution_clock::now();
-
-        // Sort by matchedWeight (descending)
-        auto merge = [&](DynamicArray<CandidateMatch>& arr, int left, int mid, int right) {
-            int n1 = mid - left + 1;
-            int n2 = right - mid;
-
-            CandidateMatch* L = new CandidateMatch[n1];
-            CandidateMatch* R = new CandidateMatch[n2];
-
-            for (int i = 0; i < n1; i++) L[i] = arr[left + i];
-            for (int j = 0; j < n2; j++) R[j] = arr[mid + 1 + j];
-
-            int i = 0, j = 0, k = left;
-
-            // Sort by matchedWeight (desc), tie-break by score
-            while (i < n1 && j < n2) {
-                if (L[i].matchedWeight > R[j].matchedWeight ||
-                    (L[i].matchedWeight == R[j].matchedWeight && L[i].score > R[j].score)) {
-                    arr[k++] = L[i++];
-                } else {
-                    arr[k++] = R[j++];
-                }
-            }
-
-            while (i < n1) arr[k++] = L[i++];
-            while (j < n2) arr[k++] = R[j++];
-
-            delete[] L;
-            delete[] R;
-        };
-
-        std::function<void(DynamicArray<CandidateMatch>&, int, int)> mergeSort;
-        mergeSort = [&](DynamicArray<CandidateMatch>& arr, int left, int right) {
-            if (left < right) {
-                int mid = left + (right - left) / 2;
-                mergeSort(arr, left, mid);
-                mergeSort(arr, mid + 1, right);
-                merge(arr, left, mid, right);
-            }
-        };
-
-        // --- Perform Merge Sort ---
-        if (matches.getSize() > 1) {
-            mergeSort(matches, 0, matches.getSize() - 1);
-        }
-
-        // --- End of sort section ---
-        auto sortEndTime = high_resolution_clock::now();
-        size_t sortEndMem = getCurrentMemoryUsageKB();
-        double sortTime = duration<double, milli>(sortEndTime - sortStartTime).count();
-        size_t sortMemoryUsed = sortEndMem - sortStartMem;
-
-        // Approximate merge sort memory model
-        size_t jobCount = matches.getSize();
-        size_t mergeMemory =
-            sizeof(Candidate*) * 5 +                 
-            sizeof(Candidate) * jobCount * 1.5 +       
-            (jobCount * 0.75) * sizeof(Candidate*) +  
-            2048; 
-
+        CachedResult result;
+        bool cached = rankQuery(selectedJob.key, candidates, index, chosenSkills, skillWeights, result);
 
+        AllocPhase previousPhase = AllocStats::enter(ALLOC_DISPLAY);
         cout << "\n================== Top 5 Matching Candidates ==================\n";
         cout << left << setw(20) << "Candidate"
              << setw(18) << "Matched Skills"
@@ -313,21 +521,17 @@ void employerMode(const DynamicArray<Job> &jobs, const DynamicArray<Candidate> &
              << "Score (%)\n";
         cout << string(63, '-') << "\n";
 
-        int topCount = 0;
-        for (int i = 0; i < matches.getSize() && topCount < 5; i++) {
-            cout << left << setw(20) << matches[i].name
-                 << setw(18) << matches[i].matchedSkills
-                 << setw(18) << matches[i].matchedWeight
-                 << fixed << setprecision(1) << (matches[i].score * 100) << "%\n";
-            topCount++;
+        for (int i = 0; i < result.rowCount; i++) {
+            cout << left << setw(20) << result.rows[i].name
+                 << setw(18) << result.rows[i].matchedSkills
+                 << setw(18) << result.rows[i].matchedWeight
+                 << fixed << setprecision(1) << (result.rows[i].score * 100) << "%\n";
         }
 
-        if (topCount == 0) {
+        if (result.rowCount == 0) {
             cout << "No candidates matched your criteria.\n";
         }
-
-        auto end = high_resolution_clock::now();
-        double totalTime = duration<double, milli>(end - start).count();
+        AllocStats::leave(previousPhase);
 
         bool showMenu = true;
         while (showMenu) {
@@ -357,9 +561,6 @@ void employerMode(const DynamicArray<Job> &jobs, const DynamicArray<Candidate> &
                 }
             }
 
-            size_t finalMemory = getCurrentMemoryUsageKB();
-            size_t memoryUsed = finalMemory - initialMemory;
-
             if (choice == 1) {
                 showMenu = false; // restart outer loop
             } 
@@ -368,13 +569,17 @@ void employerMode(const DynamicArray<Job> &jobs, const DynamicArray<Candidate> &
                 cout << "      Performance Report\n";
                 cout << "=============================\n";
                 cout << fixed << setprecision(3);
-                cout << "Search Time: " << searchTime << " ms\n";
-                cout << "Estimated Search Memory: " << (searchMemoryUsed / 1024.0) << " KB\n";
-                cout << "Sort Time: " << sortTime << " ms\n";
-                cout << "Estimated Sort Memory: " << (mergeMemory / 1024.0) << " KB\n";
+                cout << "Search Time: " << result.searchTimeMS << " ms\n";
+                cout << "Search Heap Delta: " << result.searchMemoryBytes / 1024.0 << " KB\n";
+                cout << "Sort Time: " << result.sortTimeMS << " ms\n";
+                cout << "Sort Heap Delta: " << result.sortMemoryBytes / 1024.0 << " KB\n";
+                if (index.results.enabled())
+                    cout << "Query Cache: " << (cached ? "hit" : "miss") << " (" << index.results.hits()
+                         << " hits, " << index.results.misses() << " misses)\n";
                 cout << "-------------------------------------\n";
-                cout << "Total Estimated Memory: " 
-                    << ((searchMemoryUsed + mergeMemory) / 1024.0) << " KB\n";
+                cout << "Process RSS: " << MemoryStats::currentRssKB() << " KB\n";
+                cout << "Peak RSS: " << MemoryStats::peakRssKB() << " KB\n";
+                AllocStats::printReport();
             } 
             else if (choice == 3) {
                 cout << "\n==============================================\n";
@@ -386,16 +591,66 @@ void employerMode(const DynamicArray<Job> &jobs, const DynamicArray<Candidate> &
     }
 }
 
-// ====================== Main ======================
-int main() {
-    DynamicArray<Candidate> candidates = readCandidates("resume/candidates.csv");
-    DynamicArray<Job> jobs = readJobs("job_description/mergejob.csv");
+// ====================== Engine ======================
+class MergeJumpHREngine : public Engine {
+private:
+    DynamicArray<Candidate> candidates;
+    DynamicArray<Job> jobs;
+    ScoringIndex index;
 
-    if (candidates.getSize() == 0 || jobs.getSize() == 0) {
-        cout << "Error: CSV files not found or empty.\n";
-        return 1;
+public:
+    const char* name() const override { return "Array Merge Sort and Jump Search (HR)"; }
+
+    bool loadFrom(const string &jobsFile, const string &candidatesFile) override {
+        candidates = readCandidates(candidatesFile);
+        jobs = readJobs(jobsFile);
+        if (candidates.getSize() == 0 || jobs.getSize() == 0) {
+            cout << "Error: CSV files not found or empty.\n";
+            return false;
+        }
+        buildScoringIndex(candidates, index);
+        return true;
+    }
+
+    void query() override { employerMode(jobs, candidates, index); }
+
+    int recordCount() const override { return candidates.getSize(); }
+
+    bool runQuery(const EngineQuery &query) override {
+        string title = CsvReader::normalizeKey(query.jobTitle);
+        int jobIndex = -1;
+        for (int i = 0; i < jobs.getSize() && jobIndex == -1; i++)
+            if (jobs[i].key == title) jobIndex = i;
+        if (jobIndex == -1) return false;
+
+        SkillId ids[MAX_QUERY_SKILLS];
+        int weights[MAX_QUERY_SKILLS];
+        int count = resolveQuerySkills(query, ids, weights, MAX_QUERY_SKILLS);
+        if (count == 0) return true;
+
+        DynamicArray<SkillId> chosenSkills;
+        DynamicArray<int> skillWeights;
+        for (int i = 0; i < count; i++) {
+            chosenSkills.push_back(ids[i]);
+            skillWeights.push_back(weights[i]);
+        }
+
+        CachedResult result;
+        rankQuery(jobs[jobIndex].key, candidates, index, chosenSkills, skillWeights, result);
+        return true;
     }
+};
 
-    employerMode(jobs, candidates);
-    return 0;
+Engine* createEngine() { return new MergeJumpHREngine(); }
+
+} // namespace merge_jump_hr
+
+// ====================== Main ======================
+#ifndef ENGINE_NO_MAIN
+int main(int argc, char* argv[]) {
+    ThreadPool::configure(ThreadPool::threadsFromArgs(argc, argv));
+    Ranking::configure(Ranking::modeFromArgs(argc, argv));
+    QueryCache::configure(QueryCache::capacityFromArgs(argc, argv));
+    return runEngine(merge_jump_hr::createEngine());
 }
+#endif
@@ -2,7 +2,62 @@
 #define MERGEJUMP_HR_HPP
 
 #include "../MergeJump_Common.hpp"
+#include "../../common/QueryCache.hpp"
+#include "../../common/Engine.hpp"
 
-void employerMode(const DynamicArray<Job> &jobs, const DynamicArray<Candidate> &candidates);
+namespace merge_jump_hr {
+using namespace merge_jump;
+
+// ====================== Common Functions ======================
+string toLower(const string &str);
+string trim(const string &s);
+DynamicArray<SkillId> splitSkills(string_view line);
+bool jumpSearch(const DynamicArray<SkillId> &arr, SkillId target);
+SkillMask skillMaskOf(const DynamicArray<SkillId> &skills);
+DynamicArray<Candidate> readCandidates(const string &filename);
+DynamicArray<Job> readJobs(const string &filename);
+
+// ====================== Matching ======================
+struct CandidateMatch {
+    string name;
+    int matchedSkills;
+    int matchedWeight;
+    double score;
+};
+
+// Built once per candidate set: masks packed contiguously for ScoringKernel,
+// the skill -> candidate index, and the output buffers both of them fill.
+// cache keeps the last search's matches so a weight-only change re-ranks
+// without searching, results the shown rows of recent queries.
+struct ScoringIndex {
+    DynamicArray<SkillMask> candidateMasks;
+    DynamicArray<int> hits, scoredSkills, scoredWeight;
+    SkillIndex skillIndex;
+    MatchCache cache;
+    bool matchesUnlisted = false;   // cache is still to be filled from scoredWeight
+    int unlistedCount = 0;          // with this many matches
+    QueryCache results;
+};
+
+void buildScoringIndex(const DynamicArray<Candidate> &candidates, ScoringIndex &index);
+// Search phase: fills matches and returns how many candidates matched.
+// ranked is set when matches already holds just the ranked top rows, so it
+// can be shorter than the count.
+int searchCandidates(const DynamicArray<Candidate> &candidates, ScoringIndex &index,
+                     const DynamicArray<SkillId> &chosenSkills, const DynamicArray<int> &skillWeights,
+                     DynamicArray<CandidateMatch> &matches, bool &ranked);
+// Sort phase
+void rankMatches(DynamicArray<CandidateMatch> &matches, bool ranked);
+// Both phases, timed, keeping the Top 5 rows; a query index.results already
+// holds is copied from it instead (returns true)
+bool rankQuery(const string &jobKey, const DynamicArray<Candidate> &candidates, ScoringIndex &index,
+               const DynamicArray<SkillId> &chosenSkills, const DynamicArray<int> &skillWeights,
+               CachedResult &result);
+
+void employerMode(const DynamicArray<Job> &jobs, const DynamicArray<Candidate> &candidates, ScoringIndex &index);
+
+Engine* createEngine();
+
+} // namespace merge_jump_hr
 
 #endif
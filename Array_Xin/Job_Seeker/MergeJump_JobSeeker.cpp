@@ -1,5 +1,7 @@
 #include "MergeJump_JobSeeker.hpp"
 
+namespace merge_jump_jobseeker {
+
 // ====================== Common Function Implementations ======================
 string toLower(const string &str) {
     string result = str;
@@ -13,14 +15,14 @@ string trim(const string &s) {
     return (start == string::npos) ? "" : s.substr(start, end - start + 1);
 }
 
-DynamicArray<string> splitSkills(const string &line, bool doSort = true) {
-    DynamicArray<string> skills;
-    stringstream ss(line);
-    string skill;
+DynamicArray<SkillId> splitSkills(string_view line, bool doSort) {
+    DynamicArray<SkillId> skills;
+    SkillTokenizer tokens(line);
+    string_view skill;
 
-    while (getline(ss, skill, ',')) {
-        skill = trim(skill);
-        if (!skill.empty()) skills.push_back(toLower(skill));
+    while (tokens.next(skill)) {
+        SkillId id = SkillDictionary::global().intern(skill);
+        if (id != INVALID_SKILL) skills.push_back(id);
     }
     
     if (doSort && skills.getSize() > 1) {
@@ -28,7 +30,7 @@ DynamicArray<string> splitSkills(const string &line, bool doSort = true) {
         for (int i = 0; i < skills.getSize() - 1; i++) {
             for (int j = 0; j < skills.getSize() - i - 1; j++) {
                 if (skills[j] > skills[j + 1]) {
-                    string temp = skills[j];
+                    SkillId temp = skills[j];
                     skills[j] = skills[j + 1];
                     skills[j + 1] = temp;
                 }
@@ -38,7 +40,7 @@ DynamicArray<string> splitSkills(const string &line, bool doSort = true) {
     return skills;
 }
 
-bool jumpSearch(const DynamicArray<string> &arr, const string &target) {
+bool jumpSearch(const DynamicArray<SkillId> &arr, SkillId target) {
     int n = arr.getSize();
     if (n == 0) return false;
     int step = sqrt(n);
@@ -54,25 +56,170 @@ bool jumpSearch(const DynamicArray<string> &arr, const string &target) {
     return false;
 }
 
+SkillMask skillMaskOf(const DynamicArray<SkillId> &skills) {
+    SkillMask mask = 0;
+    for (int i = 0; i < skills.getSize(); i++) SkillBitset::addSkill(mask, skills[i]);
+    return mask;
+}
+
 DynamicArray<Job> readJobs(const string &filename) {
     DynamicArray<Job> jobs;
-    ifstream file(filename);
-    string line;
+    CsvReader reader(filename);
+    jobs.reserve(reader.remainingLines());
+    CsvRow row;
+
+    while (reader.next(row)) {
+        // Built in its slot: no Job or skill array is ever copied
+        Job &j = jobs.emplace_back();
+        j.title.assign(row.key);
+        j.skills = splitSkills(row.skills, false);
+        j.hasProfile = j.skills.getSize() > 0 &&
+                       SkillBitset::buildPositionalQuery(&j.skills[0], j.skills.getSize(), j.profile);
+    }
+    jobs.shrink_to_fit();   // a CSV's line count can overshoot
+    return jobs;
+}
 
-    while (getline(file, line)) {
-        if (line.empty()) continue;
+// ====================== Matching ======================
+const int TOP_JOBS = 3;           // rows in the Top 3 table
+const int MAX_QUERY_SKILLS = 20;  // skills runQuery() passes through
+
+// jumpSearch probes the user's skills, so they are kept in ID order
+void sortUserSkills(DynamicArray<SkillId> &userSkills) {
+    for (int i = 0; i < userSkills.getSize() - 1; i++) {
+        for (int j = i + 1; j < userSkills.getSize(); j++) {
+            if (userSkills[j] < userSkills[i]) {
+                SkillId temp = userSkills[i];
+                userSkills[i] = userSkills[j];
+                userSkills[j] = temp;
+            }
+        }
+    }
+}
 
-        size_t commaPos = line.find(',');
-        if (commaPos == string::npos) continue;
+void searchJobs(const DynamicArray<Job> &jobs, const DynamicArray<SkillId> &userSkills,
+                DynamicArray<JobMatch> &results) {
+    // Bitset of the user's skills for popcount scoring
+    bool useBitset = SkillBitset::vocabularyFits();
+    SkillMask userMask = skillMaskOf(userSkills);
+
+    // Calculate weighted scores
+    for (int i = 0; i < jobs.getSize(); i++) {
+        const Job &job = jobs[i];
+        int totalSkills = job.skills.getSize();
+        int totalPossibleWeight = 0;
+        for (int w = totalSkills; w >= 1; w--)
+            totalPossibleWeight += w;
+
+        int matchedSkills = 0;
+        int matchedWeight = 0;
+
+        if (useBitset && job.hasProfile) {
+            SkillBitset::score(userMask, job.profile, matchedSkills, matchedWeight);
+        } else {
+            for (int j = 0; j < totalSkills; j++) {
+                int weight = totalSkills - j;
+                if (jumpSearch(userSkills, job.skills[j])) {
+                    matchedSkills++;
+                    matchedWeight += weight;
+                }
+            }
+        }
 
-        string title = trim(line.substr(0, commaPos));
-        string skillsStr = line.substr(commaPos + 1);
-        Job j;
-        j.title = title;
-        j.skills = splitSkills(skillsStr, false); 
-        jobs.push_back(j);
+        double percentage = (double)matchedWeight / totalPossibleWeight * 100.0;
+
+        // Only store results with non-zero match
+        if (matchedSkills > 0) {
+            JobMatch r{job.title, matchedSkills, matchedWeight, percentage};
+            results.push_back(move(r));
+        }
+    }
+}
+
+// Sort by weight (descending)
+static void mergeJobs(DynamicArray<JobMatch>& arr, int left, int mid, int right) {
+    int n1 = mid - left + 1;
+    int n2 = right - mid;
+
+    JobMatch* L = new JobMatch[n1];
+    JobMatch* R = new JobMatch[n2];
+
+    for (int i = 0; i < n1; i++) L[i] = move(arr[left + i]);
+    for (int j = 0; j < n2; j++) R[j] = move(arr[mid + 1 + j]);
+
+    int i = 0, j = 0, k = left;
+
+    // Sort by matchedWeight DESC, then percentage DESC; the left run wins
+    // full ties, so equal jobs keep load order as in the top-K path
+    while (i < n1 && j < n2) {
+        if (!(R[j].matchedWeight > L[i].matchedWeight ||
+              (R[j].matchedWeight == L[i].matchedWeight &&
+               R[j].percentage > L[i].percentage))) {
+            arr[k++] = move(L[i++]);
+        } else {
+            arr[k++] = move(R[j++]);
+        }
+    }
+
+    while (i < n1) arr[k++] = move(L[i++]);
+    while (j < n2) arr[k++] = move(R[j++]);
+
+    delete[] L;
+    delete[] R;
+}
+
+// Recursive merge sort
+static void mergeSortJobs(DynamicArray<JobMatch>& arr, int left, int right) {
+    if (left < right) {
+        int mid = left + (right - left) / 2;
+        mergeSortJobs(arr, left, mid);
+        mergeSortJobs(arr, mid + 1, right);
+        mergeJobs(arr, left, mid, right);
+    }
+}
+
+// Stable counting sort in mergeJobs' order: matchedWeight in the high bits
+// of the key, the percentage as a fixed-point tie-break below it
+static void countingSortJobs(DynamicArray<JobMatch>& arr) {
+    int n = arr.getSize();
+    uint64_t* keys = new uint64_t[n];
+    int* order = new int[n];
+    for (int i = 0; i < n; i++)
+        keys[i] = ((uint64_t)arr[i].matchedWeight << CountingRank::PERCENT_BITS) |
+                  CountingRank::percentKey(arr[i].percentage);
+    CountingRank::rank(keys, n, order);
+
+    DynamicArray<JobMatch> ranked;
+    ranked.reserve(n);
+    for (int i = 0; i < n; i++) ranked.push_back(move(arr[order[i]]));
+    arr = move(ranked);
+
+    delete[] keys;
+    delete[] order;
+}
+
+// Top-K selection when only a few rows are shown, merge sort otherwise;
+// the ranking mode can force either sort
+void rankJobs(DynamicArray<JobMatch> &results) {
+    if (Ranking::selectTop(TOP_JOBS, results.getSize())) {
+        auto better = [&](int a, int b) {
+            return results[a].matchedWeight > results[b].matchedWeight ||
+                   (results[a].matchedWeight == results[b].matchedWeight &&
+                    results[a].percentage > results[b].percentage);
+        };
+        TopK<int, decltype(better)> top(TOP_JOBS, better);
+        for (int i = 0; i < results.getSize(); i++) top.push(i);
+
+        int order[TOP_JOBS];
+        JobMatch picked[TOP_JOBS];
+        int kept = top.take(order);
+        for (int i = 0; i < kept; i++) picked[i] = results[order[i]];
+        for (int i = 0; i < kept; i++) results[i] = picked[i];
+    } else if (Ranking::counting()) {
+        countingSortJobs(results);
+    } else if (results.getSize() > 1) {
+        mergeSortJobs(results, 0, results.getSize() - 1);
     }
-    return jobs;
 }
 
 // ====================== Job Seeker Mode ======================
@@ -103,7 +250,8 @@ void jobSeekerMode(const DynamicArray<Job> &jobs) {
             }
         }
 
-        DynamicArray<string> userSkills;
+        // Skills the jobs never mention cannot match, so only known IDs are kept
+        DynamicArray<SkillId> userSkills;
         for (int i = 0; i < skillCount; i++) {
             cout << "Enter your skill " << (i + 1) << ": ";
             string s;
@@ -114,118 +262,31 @@ void jobSeekerMode(const DynamicArray<Job> &jobs) {
                 i--; 
                 continue;
             }
-            userSkills.push_back(s);
+            SkillId id = SkillDictionary::global().find(s);
+            if (id != INVALID_SKILL) userSkills.push_back(id);
         }
 
-        for (int i = 0; i < userSkills.getSize() - 1; i++) {
-            for (int j = i + 1; j < userSkills.getSize(); j++) {
-                if (userSkills[j] < userSkills[i]) {
-                    string temp = userSkills[i];
-                    userSkills[i] = userSkills[j];
-                    userSkills[j] = temp;
-                }
-            }
-        }
+        sortUserSkills(userSkills);
 
         // Start timer
+        MemoryPhase searchMemory(ALLOC_SEARCH);
+        searchMemory.start();
         auto searchStart = high_resolution_clock::now();
 
-        struct Result {
-            string title;
-            int matchedSkills;
-            int matchedWeight;
-            double percentage;
-        };
-
-        DynamicArray<Result> results;
-
-        // Calculate weighted scores
-        for (int i = 0; i < jobs.getSize(); i++) {
-            const Job &job = jobs[i];
-            int totalSkills = job.skills.getSize();
-            int totalPossibleWeight = 0;
-            for (int w = totalSkills; w >= 1; w--)
-                totalPossibleWeight += w;
-
-            int matchedSkills = 0;
-            int matchedWeight = 0;
-
-            for (int j = 0; j < totalSkills; j++) {
-                int weight = totalSkills - j;
-                string skill = trim(toLower(job.skills[j]));
-
-                if (jumpSearch(userSkills, skill)) {
-                    matchedSkills++;
-                    matchedWeight += weight;
-                }
-            }
-
-            double percentage = (double)matchedWeight / totalPossibleWeight * 100.0;
-
-            // Only store results with non-zero match
-            if (matchedSkills > 0) {
-                Result r{job.title, matchedSkills, matchedWeight, percentage};
-                results.push_back(r);
-            }
-        }
+        DynamicArray<JobMatch> results;
+        searchJobs(jobs, userSkills, results);
 
          // End of search phase
         auto searchEnd = high_resolution_clock::now();
         double searchTime = duration<double, milli>(searchEnd - searchStart).count();
-
-        // Conceptual search memory estimation
-        size_t searchMemoryUsed = sizeof(string) * userSkills.getSize()        // user's skills
-                                + sizeof(string) * jobs.getSize() * 0.1        // fraction of job skills actively checked
-                                + sizeof(int) * 5;                             // loop vars etc.
+        searchMemory.stop();
 
         // Start timer for sorting phase
+        MemoryPhase sortMemory(ALLOC_SORT);
+        sortMemory.start();
         auto sortStart = high_resolution_clock::now();
 
-        // Sort by weight (descending)
-        auto merge = [](DynamicArray<Result>& arr, int left, int mid, int right) {
-            int n1 = mid - left + 1;
-            int n2 = right - mid;
-
-            Result* L = new Result[n1];
-            Result* R = new Result[n2];
-
-            for (int i = 0; i < n1; i++) L[i] = arr[left + i];
-            for (int j = 0; j < n2; j++) R[j] = arr[mid + 1 + j];
-
-            int i = 0, j = 0, k = left;
-
-            // Sort by matchedWeight DESC, then percentage DESC
-            while (i < n1 && j < n2) {
-                if (L[i].matchedWeight > R[j].matchedWeight ||
-                    (L[i].matchedWeight == R[j].matchedWeight &&
-                    L[i].percentage > R[j].percentage)) {
-                    arr[k++] = L[i++];
-                } else {
-                    arr[k++] = R[j++];
-                }
-            }
-
-            while (i < n1) arr[k++] = L[i++];
-            while (j < n2) arr[k++] = R[j++];
-
-            delete[] L;
-            delete[] R;
-        };
-
-        // Recursive merge sort
-        std::function<void(DynamicArray<Result>&, int, int)> mergeSort =
-            [&](DynamicArray<Result>& arr, int left, int right) {
-                if (left < right) {
-                    int mid = left + (right - left) / 2;
-                    mergeSort(arr, left, mid);
-                    mergeSort(arr, mid + 1, right);
-                    merge(arr, left, mid, right);
-                }
-            };
-
-        // Perform merge sort if results not empty
-        if (results.getSize() > 1)
-            mergeSort(results, 0, results.getSize() - 1);
+        rankJobs(results);
 
         // End of sorting phase
         volatile double dummy = 0;
@@ -235,17 +296,10 @@ void jobSeekerMode(const DynamicArray<Job> &jobs) {
 
         auto sortEnd = high_resolution_clock::now();
         double sortTime = duration<double, milli>(sortEnd - sortStart).count();
-
-        // Conceptual merge/sort memory estimation
-        size_t resultCount = results.getSize();
-        size_t sortMemoryUsed = sizeof(Result*) * 45
-                      + sizeof(Result) * (resultCount * 12)
-                      + (resultCount * 7) * sizeof(Result*)
-                      + sizeof(double) * (resultCount * 7)
-                      + sizeof(int) * (resultCount * 6)
-                      + (resultCount * resultCount / 10);
+        sortMemory.stop();
 
         // Display top 3 jobs
+        AllocPhase previousPhase = AllocStats::enter(ALLOC_DISPLAY);
         if (results.getSize() > 0) {
             cout << "\nTop 3 Best-Matching Jobs:\n";
             cout << left << setw(20) << "Job Title"
@@ -254,7 +308,7 @@ void jobSeekerMode(const DynamicArray<Job> &jobs) {
                  << setw(15) << "Percentage\n";
             cout << string(65, '-') << "\n";
 
-            int topN = min(3, results.getSize());
+            int topN = min(TOP_JOBS, results.getSize());
             for (int i = 0; i < topN; i++) {
                 cout << left << setw(20) << results[i].title
                      << setw(15) << results[i].matchedSkills
@@ -265,6 +319,7 @@ void jobSeekerMode(const DynamicArray<Job> &jobs) {
         } else {
             cout << "\nNo matching jobs found.\n";
         }
+        AllocStats::leave(previousPhase);
 
         // Action menu
         bool backToMenu = false;
@@ -299,12 +354,13 @@ void jobSeekerMode(const DynamicArray<Job> &jobs) {
                 cout << "=============================\n";
                 cout << fixed << setprecision(3);
                 cout << "Search Time: " << searchTime << " ms\n";
-                cout << "Estimated Search Memory: " << (searchMemoryUsed / 1024.0) << " KB\n";
+                cout << "Search Heap Delta: " << searchMemory.heapDeltaKB() << " KB\n";
                 cout << "Sort Time: " << sortTime << " ms\n";
-                cout << "Estimated Sort Memory: " << (sortMemoryUsed / 1024.0) << " KB\n";
+                cout << "Sort Heap Delta: " << sortMemory.heapDeltaKB() << " KB\n";
                 cout << "-------------------------------------\n";
-                cout << "Total Estimated Memory: "
-                     << ((searchMemoryUsed + sortMemoryUsed) / 1024.0) << " KB\n";
+                cout << "Process RSS: " << MemoryStats::currentRssKB() << " KB\n";
+                cout << "Peak RSS: " << MemoryStats::peakRssKB() << " KB\n";
+                AllocStats::printReport();
             }
             else if (choice == 3) {
                 cout << "\n==============================================\n";
@@ -317,15 +373,51 @@ void jobSeekerMode(const DynamicArray<Job> &jobs) {
     }
 }
 
-// ====================== Main ======================
-int main() {
-    DynamicArray<Job> jobs = readJobs("job_description/mergejob.csv");
+// ====================== Engine ======================
+class MergeJumpJobSeekerEngine : public Engine {
+private:
+    DynamicArray<Job> jobs;
 
-    if (jobs.getSize() == 0) {
-        cout << "Error: CSV file not found or empty.\n";
-        return 1;
+public:
+    const char* name() const override { return "Array Merge Sort and Jump Search (Job Seeker)"; }
+
+    bool loadFrom(const string &jobsFile, const string &) override {
+        jobs = readJobs(jobsFile);
+        if (jobs.getSize() == 0) {
+            cout << "Error: CSV file not found or empty.\n";
+            return false;
+        }
+        return true;
     }
 
-    jobSeekerMode(jobs);
-    return 0;
+    void query() override { jobSeekerMode(jobs); }
+
+    int recordCount() const override { return jobs.getSize(); }
+
+    bool runQuery(const EngineQuery &query) override {
+        SkillId ids[MAX_QUERY_SKILLS];
+        int weights[MAX_QUERY_SKILLS];
+        int count = resolveQuerySkills(query, ids, weights, MAX_QUERY_SKILLS);
+
+        DynamicArray<SkillId> userSkills;
+        for (int i = 0; i < count; i++) userSkills.push_back(ids[i]);
+        sortUserSkills(userSkills);
+
+        DynamicArray<JobMatch> results;
+        searchJobs(jobs, userSkills, results);
+        rankJobs(results);
+        return true;
+    }
+};
+
+Engine* createEngine() { return new MergeJumpJobSeekerEngine(); }
+
+} // namespace merge_jump_jobseeker
+
+// ====================== Main ======================
+#ifndef ENGINE_NO_MAIN
+int main(int argc, char* argv[]) {
+    Ranking::configure(Ranking::modeFromArgs(argc, argv));
+    return runEngine(merge_jump_jobseeker::createEngine());
 }
+#endif
@@ -2,7 +2,38 @@
 #define MERGEJUMP_JOBSEEKER_HPP
 
 #include "../MergeJump_Common.hpp"
+#include "../../common/Engine.hpp"
+
+namespace merge_jump_jobseeker {
+using namespace merge_jump;
+
+// ====================== Common Functions ======================
+string toLower(const string &str);
+string trim(const string &s);
+DynamicArray<SkillId> splitSkills(string_view line, bool doSort = true);
+bool jumpSearch(const DynamicArray<SkillId> &arr, SkillId target);
+SkillMask skillMaskOf(const DynamicArray<SkillId> &skills);
+DynamicArray<Job> readJobs(const string &filename);
+
+// ====================== Matching ======================
+struct JobMatch {
+    string title;
+    int matchedSkills;
+    int matchedWeight;
+    double percentage;
+};
+
+void sortUserSkills(DynamicArray<SkillId> &userSkills);
+// Search phase: every job with at least one of the user's skills
+void searchJobs(const DynamicArray<Job> &jobs, const DynamicArray<SkillId> &userSkills,
+                DynamicArray<JobMatch> &results);
+// Sort phase
+void rankJobs(DynamicArray<JobMatch> &results);
 
 void jobSeekerMode(const DynamicArray<Job> &jobs);
 
+Engine* createEngine();
+
+} // namespace merge_jump_jobseeker
+
 #endif
@@ -9,14 +9,33 @@
 #include <cmath>
 #include <chrono>
 #include <iomanip>
-#include <windows.h>
-#include <psapi.h>
+#include <limits>
 #include <functional>
-#pragma comment(lib, "psapi.lib")
+#include <memory>
+#include <new>
+#include <utility>
+#include "../common/CsvLoader.hpp"
+#include "../common/Snapshot.hpp"
+#include "../common/SkillDictionary.hpp"
+#include "../common/SkillBitset.hpp"
+#include "../common/ScoringKernel.hpp"
+#include "../common/SkillIndex.hpp"
+#include "../common/MatchCache.hpp"
+#include "../common/TopK.hpp"
+#include "../common/CountingRank.hpp"
+#include "../common/ThreadPool.hpp"
+#include "../common/MemoryStats.hpp"
 using namespace std;
 using namespace chrono;
 
+// Shared by the HR and job seeker engines, each of which lives in its own
+// namespace so the launcher can link both
+namespace merge_jump {
+
 // ====================== DynamicArray Template ======================
+// Growable array over raw storage: slots past size are never constructed,
+// growth moves the elements across instead of copying them, and returning
+// or assigning a temporary array hands over its buffer.
 template<typename T>
 class DynamicArray {
 private:
@@ -24,44 +43,92 @@ private:
     int capacity;
     int size;
 
-    void resize() {
-        capacity = capacity == 0 ? 1 : capacity * 2;
-        T* newData = new T[capacity];
-        for (int i = 0; i < size; i++) newData[i] = data[i];
-        delete[] data;
+    static T* allocate(int count) { return count > 0 ? allocator<T>().allocate(count) : nullptr; }
+    static void deallocate(T* block, int count) {
+        if (block) allocator<T>().deallocate(block, count);
+    }
+
+    // Moves the elements into a buffer of newCapacity (>= size)
+    void reallocate(int newCapacity) {
+        T* newData = allocate(newCapacity);
+        for (int i = 0; i < size; i++) {
+            new (&newData[i]) T(move_if_noexcept(data[i]));
+            data[i].~T();
+        }
+        deallocate(data, capacity);
         data = newData;
+        capacity = newCapacity;
+    }
+
+    void destroyAll() {
+        for (int i = 0; i < size; i++) data[i].~T();
+        size = 0;
     }
 
 public:
     DynamicArray() : data(nullptr), capacity(0), size(0) {}
-    DynamicArray(const DynamicArray& other) : data(nullptr), capacity(0), size(0) {
-        if (other.size > 0) {
-            capacity = other.capacity;
-            size = other.size;
-            data = new T[capacity];
-            for (int i = 0; i < size; i++) data[i] = other.data[i];
-        }
+    DynamicArray(const DynamicArray& other) : data(allocate(other.size)), capacity(other.size), size(0) {
+        for (; size < other.size; size++) new (&data[size]) T(other.data[size]);
+    }
+    DynamicArray(DynamicArray&& other) noexcept : data(other.data), capacity(other.capacity), size(other.size) {
+        other.data = nullptr;
+        other.capacity = 0;
+        other.size = 0;
     }
     DynamicArray& operator=(const DynamicArray& other) {
         if (this != &other) {
-            delete[] data;
-            data = nullptr;
-            capacity = 0;
-            size = 0;
-            if (other.size > 0) {
-                capacity = other.capacity;
-                size = other.size;
-                data = new T[capacity];
-                for (int i = 0; i < size; i++) data[i] = other.data[i];
-            }
+            DynamicArray copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+    DynamicArray& operator=(DynamicArray&& other) noexcept {
+        if (this != &other) {
+            clear();
+            swap(other);
         }
         return *this;
     }
-    ~DynamicArray() { delete[] data; }
+    ~DynamicArray() { clear(); }
+
+    void swap(DynamicArray& other) noexcept {
+        std::swap(data, other.data);
+        std::swap(capacity, other.capacity);
+        std::swap(size, other.size);
+    }
+
+    // Constructs the element in place. When the array has to grow, the new
+    // element is built first, so args may refer to an element of this array.
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (size < capacity) {
+            new (&data[size]) T(forward<Args>(args)...);
+        } else {
+            int newCapacity = capacity == 0 ? 1 : capacity * 2;
+            T* newData = allocate(newCapacity);
+            new (&newData[size]) T(forward<Args>(args)...);
+            for (int i = 0; i < size; i++) {
+                new (&newData[i]) T(move_if_noexcept(data[i]));
+                data[i].~T();
+            }
+            deallocate(data, capacity);
+            data = newData;
+            capacity = newCapacity;
+        }
+        return data[size++];
+    }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(move(value)); }
+
+    // Room for count elements without further growth
+    void reserve(int count) {
+        if (count > capacity) reallocate(count);
+    }
 
-    void push_back(const T& value) {
-        if (size >= capacity) resize();
-        data[size++] = value;
+    // Gives back the slack left by doubling
+    void shrink_to_fit() {
+        if (size < capacity) reallocate(size);
     }
 
     T& operator[](int index) { return data[index]; }
@@ -71,22 +138,27 @@ public:
     int getCapacity() const { return capacity; }
 
     void clear() {
-        delete[] data;
+        destroyAll();
+        deallocate(data, capacity);
         data = nullptr;
         capacity = 0;
-        size = 0;
     }
 };
 
 // ====================== Structs ======================
+// Skills are interned IDs; SkillDictionary::global() maps them back to text
 struct Candidate {
     string name;
-    DynamicArray<string> skills;
+    DynamicArray<SkillId> skills;
+    SkillMask mask;          // bitset of skills, exact when SkillBitset::vocabularyFits()
 };
 
 struct Job {
     string title;
-    DynamicArray<string> skills;
+    string key;              // normalized title for merge_jump_hr's title lookup, empty in the job seeker
+    DynamicArray<SkillId> skills;
+    WeightedQuery profile;   // positional skill weights for job seeker scoring
+    bool hasProfile;
 };
 
 struct ScorePair {
@@ -94,12 +166,6 @@ struct ScorePair {
     double score;
 };
 
-// ====================== Common Functions ======================
-string toLower(const string &str);
-string trim(const string &s);
-DynamicArray<string> splitSkills(const string &line);
-bool jumpSearch(const DynamicArray<string> &arr, const string &target);
-DynamicArray<Candidate> readCandidates(const string &filename);
-DynamicArray<Job> readJobs(const string &filename);
+} // namespace merge_jump
 
 #endif
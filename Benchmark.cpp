@@ -0,0 +1,536 @@
+// Benchmark: runs every engine headless (Engine::runQuery) across dataset
+// sizes and reports per-query latency, so the array and linked list engines
+// can be compared on the same data and regressions show up as numbers
+// rather than one clock reading inside a menu.
+//
+// For each size the benchmark writes a dataset under the data directory
+// once, then gives every engine a fresh child process: load, warm up, time
+// one query per repetition. A child that crashes or runs past the timeout
+// is reported and the run goes on. Once an engine takes longer than the
+// budget at one size, its larger sizes are skipped.
+//
+//   HR engines       rank N candidates (candidates_N.csv) for the real jobs
+//   Job seeker       rank N jobs (jobs_N.csv)
+// Datasets come from DatasetGenerator with its default options (Zipf
+// popularity, fixed seed), so every run measures the same data. Each size is
+// generated once per vocabulary: the cleaners' 29 skills, and a large one
+// (1K skills by default) that exercises the engines past the 64-skill
+// bitsets and any fixed-size skill tables. Queries cycle through the checked-in jobs: HR asks for a job
+// title and its first skills with falling weights, job seekers give a job's
+// first skills.
+//
+// Status: ok, capped (the engine kept fewer than N records), load-failed,
+// bad-query (a job title was not found), crashed, timeout, skipped.
+//
+// Usage: ./Benchmark [--sizes 1K,10K,...] [--vocabularies 29,1K,...] [--engines all|hr|js|KEY,...]
+//                    [--warmup N] [--reps N] [--budget-ms MS] [--timeout SEC]
+//                    [--data-dir DIR] [--csv FILE] [--json FILE] [--threads N]
+//                    [--ranking auto|sort|counting] [--query-cache N]
+// --ranking applies to every engine; "sort" and "counting" rank all matches
+// instead of selecting the top rows, so their sorts can be compared.
+// The HR engines' query result caches are off unless --query-cache sizes
+// them: the query mix repeats, so with them on the timed queries measure
+// cache hits rather than searches.
+//
+// Build from the repository root (Linux / POSIX only):
+//   g++ -std=c++17 -O2 -DENGINE_NO_MAIN Benchmark.cpp
+//       ./Array_Jing/Array_HR/InsertionBinary_HR.cpp ./Array_Xin/HR/MergeJump_HR.cpp
+//       ./linked_list/hr/LinearInsertion_HR.cpp ./linked_list/hr/OptimizedMerge_HR.cpp
+//       ./Array_Jing/Array_jobseeker/InsertionBinary_JobSeeker.cpp ./Array_Xin/Job_Seeker/MergeJump_JobSeeker.cpp
+//       ./linked_list/job_seeker/LinearInsertion_JobSeeker.cpp ./linked_list/job_seeker/OptimizedMerge_JobSeeker.cpp
+//       ./common/CsvLoader.cpp ./common/SkillDictionary.cpp ./common/SkillBitset.cpp ./common/ScoringKernel.cpp
+//       ./common/SkillIndex.cpp ./common/ThreadPool.cpp ./common/Snapshot.cpp ./common/MemoryStats.cpp
+//       ./common/AllocStats.cpp ./common/DatasetGenerator.cpp ./common/NodeArena.cpp ./common/CountingRank.cpp
+//       ./common/MatchCache.cpp ./common/QueryCache.cpp -pthread -o Benchmark
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <iomanip>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <cerrno>
+#include <csignal>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include "common/Engine.hpp"
+#include "common/EngineCatalog.hpp"
+#include "common/CsvLoader.hpp"
+#include "common/DatasetGenerator.hpp"
+#include "common/MemoryStats.hpp"
+#include "common/ThreadPool.hpp"
+#include "common/CountingRank.hpp"
+#include "common/QueryCache.hpp"
+
+using namespace std;
+using namespace std::chrono;
+
+// ---------- Constants ----------
+const char* DEFAULT_SIZES = "1K,10K,100K,1M,10M";
+const char* DEFAULT_VOCABULARIES = "29,1K";   // the cleaners' skills, then a large vocabulary
+const char* DEFAULT_DATA_DIR = "bench_data";
+const int HR_QUERY_SKILLS = 3;   // skills per HR query, weighted 10, 7, 4
+const int JS_QUERY_SKILLS = 4;   // skills per job seeker query
+
+// ---------- Options ----------
+struct Options {
+    vector<int> sizes;
+    vector<int> vocabularies;
+    bool selected[ENGINE_COUNT] = {};
+    int warmup = 3;
+    int reps = 30;
+    double budgetMs = 60000.0;
+    int timeoutSec = 600;
+    string dataDir = DEFAULT_DATA_DIR;
+    string csvPath;
+    string jsonPath;
+    RankingMode ranking = RANK_AUTO;
+    int queryCache = 0;
+};
+
+// ---------- Query Mix ----------
+struct BenchQuery {
+    string title;
+    vector<string> skills;
+    vector<int> weights;
+};
+
+// ---------- Case Result ----------
+// Plain data so the child can send it back over a pipe in one write
+struct CaseResult {
+    char status[16];
+    int records;
+    double loadMs;
+    double medianMs;
+    double p99Ms;
+    double meanMs;
+    double qps;
+    long long peakRssKB;
+};
+
+struct CaseRow {
+    int engine;
+    int size;
+    int vocabulary;
+    CaseResult result;
+};
+
+static void setStatus(CaseResult &result, const char* status) {
+    strncpy(result.status, status, sizeof(result.status) - 1);
+    result.status[sizeof(result.status) - 1] = '\0';
+}
+
+// ---------- Argument Parsing ----------
+static vector<string> splitList(const string &text) {
+    vector<string> items;
+    stringstream ss(text);
+    string item;
+    while (getline(ss, item, ','))
+        if (!item.empty()) items.push_back(item);
+    return items;
+}
+
+static bool parseSizes(const string &text, Options &options) {
+    options.sizes.clear();
+    for (const string &item : splitList(text)) {
+        long long size = DatasetGenerator::parseCount(item);
+        if (size <= 0 || size > 100000000) return false;
+        options.sizes.push_back((int)size);
+    }
+    return !options.sizes.empty();
+}
+
+static bool parseVocabularies(const string &text, Options &options) {
+    options.vocabularies.clear();
+    for (const string &item : splitList(text)) {
+        long long size = DatasetGenerator::parseCount(item);
+        if (size <= 0 || size > MAX_VOCABULARY_SIZE) return false;
+        options.vocabularies.push_back((int)size);
+    }
+    return !options.vocabularies.empty();
+}
+
+static bool parseEngines(const string &text, Options &options) {
+    bool any = false;
+    for (int e = 0; e < ENGINE_COUNT; e++) options.selected[e] = false;
+    for (const string &item : splitList(text)) {
+        bool known = false;
+        for (int e = 0; e < ENGINE_COUNT; e++) {
+            const EngineEntry &entry = ENGINE_CATALOG[e];
+            if (item == "all" || item == entry.key || (item == "hr" && entry.hr) || (item == "js" && !entry.hr)) {
+                options.selected[e] = true;
+                known = any = true;
+            }
+        }
+        if (!known) return false;
+    }
+    return any;
+}
+
+static bool parseArgs(int argc, char* argv[], Options &options) {
+    parseSizes(DEFAULT_SIZES, options);
+    parseVocabularies(DEFAULT_VOCABULARIES, options);
+    parseEngines("all", options);
+
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (i + 1 >= argc) return false;
+        string value = argv[++i];
+
+        if (arg == "--sizes") {
+            if (!parseSizes(value, options)) return false;
+        } else if (arg == "--vocabularies") {
+            if (!parseVocabularies(value, options)) return false;
+        } else if (arg == "--engines") {
+            if (!parseEngines(value, options)) return false;
+        } else if (arg == "--warmup") {
+            options.warmup = atoi(value.c_str());
+            if (options.warmup < 0) return false;
+        } else if (arg == "--reps") {
+            options.reps = atoi(value.c_str());
+            if (options.reps < 1) return false;
+        } else if (arg == "--budget-ms") {
+            options.budgetMs = atof(value.c_str());
+            if (options.budgetMs <= 0) return false;
+        } else if (arg == "--timeout") {
+            options.timeoutSec = atoi(value.c_str());
+            if (options.timeoutSec < 1) return false;
+        } else if (arg == "--data-dir") {
+            options.dataDir = value;
+        } else if (arg == "--csv") {
+            options.csvPath = value;
+        } else if (arg == "--json") {
+            options.jsonPath = value;
+        } else if (arg == "--ranking") {
+            if (!Ranking::parse(value.c_str(), options.ranking)) return false;
+        } else if (arg == "--query-cache") {
+            options.queryCache = atoi(value.c_str());
+            if (options.queryCache < 0) return false;
+        } else if (arg != "--threads") {   // read by ThreadPool::threadsFromArgs
+            return false;
+        }
+    }
+    return true;
+}
+
+// ---------- Query Mix ----------
+static vector<BenchQuery> loadQueries(bool hr) {
+    vector<BenchQuery> queries;
+    CsvReader reader(DEFAULT_JOBS_FILE);
+    CsvRow row;
+    while (reader.next(row)) {
+        BenchQuery query;
+        query.title = string(row.key);
+        int limit = hr ? HR_QUERY_SKILLS : JS_QUERY_SKILLS;
+        SkillTokenizer tokens(row.skills);
+        string_view skill;
+        while ((int)query.skills.size() < limit && tokens.next(skill)) {
+            query.skills.push_back(string(skill));
+            query.weights.push_back(10 - 3 * (int)query.weights.size());
+        }
+        if (!query.skills.empty()) queries.push_back(query);
+    }
+    return queries;
+}
+
+static EngineQuery engineQuery(const BenchQuery &query) {
+    EngineQuery view;
+    view.jobTitle = query.title;
+    view.skills = query.skills.data();
+    view.weights = query.weights.data();
+    view.skillCount = (int)query.skills.size();
+    return view;
+}
+
+// ---------- Datasets ----------
+// "dir/candidates_N.csv" for the cleaners' vocabulary, "dir/candidates_N_vV.csv" otherwise
+static string datasetPath(const Options &options, const char* kind, int rows, int vocabulary) {
+    string path = options.dataDir + "/" + kind + "_" + to_string(rows);
+    if (vocabulary != BASE_VOCABULARY_SIZE) path += "_v" + to_string(vocabulary);
+    return path + ".csv";
+}
+
+// Generates `rows` candidates or jobs into target; an existing target is reused
+static bool generateDataset(const string &target, int rows, int vocabulary, bool candidates) {
+    struct stat info;
+    if (stat(target.c_str(), &info) == 0) return true;
+
+    GeneratorOptions generatorOptions;
+    generatorOptions.rows = rows;
+    generatorOptions.vocabularySize = vocabulary;
+    DatasetGenerator generator(generatorOptions);
+
+    // Written under a temporary name so an interrupted run leaves no half file
+    string partial = target + ".partial";
+    bool written = candidates ? generator.writeCandidates(partial) : generator.writeJobs(partial);
+    if (!written || rename(partial.c_str(), target.c_str()) != 0) {
+        cerr << "Cannot write " << target << endl;
+        return false;
+    }
+    return true;
+}
+
+// ---------- Child Process ----------
+static void runChild(const EngineEntry &entry, const string &jobsFile, const string &candidatesFile,
+                     const vector<BenchQuery> &queries, const Options &options, int fd) {
+    // Engines print while loading; keep the report readable
+    int devNull = open("/dev/null", O_WRONLY);
+    if (devNull >= 0) {
+        dup2(devNull, STDOUT_FILENO);
+        close(devNull);
+    }
+
+    CaseResult result = {};
+    setStatus(result, "ok");
+    Engine* engine = entry.create();
+
+    auto loadStart = steady_clock::now();
+    bool loaded = engine->loadFrom(jobsFile, candidatesFile);
+    result.loadMs = duration<double, milli>(steady_clock::now() - loadStart).count();
+
+    if (!loaded) {
+        setStatus(result, "load-failed");
+    } else {
+        result.records = engine->recordCount();
+        vector<EngineQuery> mix;
+        for (const BenchQuery &query : queries) mix.push_back(engineQuery(query));
+
+        size_t next = 0;
+        for (int i = 0; i < options.warmup; i++)
+            engine->runQuery(mix[next++ % mix.size()]);
+
+        vector<double> times(options.reps);
+        bool found = true;
+        for (int i = 0; i < options.reps; i++) {
+            auto start = steady_clock::now();
+            found = engine->runQuery(mix[next++ % mix.size()]) && found;
+            times[i] = duration<double, milli>(steady_clock::now() - start).count();
+        }
+
+        double total = 0.0;
+        for (double t : times) total += t;
+        sort(times.begin(), times.end());
+        int n = (int)times.size();
+        result.medianMs = (n % 2) ? times[n / 2] : (times[n / 2 - 1] + times[n / 2]) / 2.0;
+        int rank99 = (99 * n + 99) / 100;   // nearest rank: ceil(0.99 n)
+        result.p99Ms = times[rank99 - 1];
+        result.meanMs = total / n;
+        result.qps = total > 0.0 ? n / (total / 1000.0) : 0.0;
+
+        // "capped" is decided by the parent, which knows the case's size
+        if (!found) setStatus(result, "bad-query");
+    }
+    result.peakRssKB = (long long)MemoryStats::peakRssKB();
+
+    ssize_t written = write(fd, &result, sizeof(result));
+    _exit(written == (ssize_t)sizeof(result) ? 0 : 1);
+}
+
+// Runs one engine at one size in its own process
+static CaseResult runCase(const EngineEntry &entry, int size, const string &jobsFile, const string &candidatesFile,
+                          const vector<BenchQuery> &queries, const Options &options) {
+    CaseResult result = {};
+    int fds[2];
+    if (pipe(fds) != 0) {
+        setStatus(result, "crashed");
+        return result;
+    }
+
+    cout.flush();
+    pid_t pid = fork();
+    if (pid < 0) {
+        close(fds[0]);
+        close(fds[1]);
+        setStatus(result, "crashed");
+        return result;
+    }
+    if (pid == 0) {
+        close(fds[0]);
+        runChild(entry, jobsFile, candidatesFile, queries, options, fds[1]);
+    }
+    close(fds[1]);
+
+    pollfd waitFor = { fds[0], POLLIN, 0 };
+    int ready;
+    do {
+        ready = poll(&waitFor, 1, options.timeoutSec * 1000);
+    } while (ready < 0 && errno == EINTR);
+
+    bool received = false;
+    if (ready > 0)
+        received = read(fds[0], &result, sizeof(result)) == (ssize_t)sizeof(result);
+    else
+        kill(pid, SIGKILL);
+    close(fds[0]);
+
+    int status = 0;
+    waitpid(pid, &status, 0);
+
+    if (ready == 0) {
+        result = {};
+        setStatus(result, "timeout");
+    } else if (!received || WIFSIGNALED(status)) {
+        result = {};
+        setStatus(result, "crashed");
+    } else if (strcmp(result.status, "ok") == 0 && result.records < size) {
+        setStatus(result, "capped");
+    }
+    return result;
+}
+
+// ---------- Reports ----------
+static void printHeader() {
+    cout << left << setw(22) << "Engine"
+         << right << setw(10) << "Size"
+         << setw(8) << "Vocab"
+         << setw(10) << "Records"
+         << setw(13) << "Status"
+         << setw(11) << "Load ms"
+         << setw(11) << "Median ms"
+         << setw(11) << "p99 ms"
+         << setw(11) << "Mean ms"
+         << setw(12) << "QPS"
+         << setw(12) << "Peak KB" << "\n";
+    cout << string(131, '-') << "\n";
+}
+
+static void printRow(const CaseRow &row) {
+    const CaseResult &r = row.result;
+    cout << left << setw(22) << ENGINE_CATALOG[row.engine].key
+         << right << setw(10) << row.size
+         << setw(8) << row.vocabulary
+         << setw(10) << r.records
+         << setw(13) << r.status
+         << fixed << setprecision(3)
+         << setw(11) << r.loadMs
+         << setw(11) << r.medianMs
+         << setw(11) << r.p99Ms
+         << setw(11) << r.meanMs
+         << setprecision(1) << setw(12) << r.qps
+         << setw(12) << r.peakRssKB << "\n";
+    cout.unsetf(ios::fixed);
+    cout << left;
+}
+
+static bool writeCsv(const string &path, const vector<CaseRow> &rows) {
+    ofstream out(path);
+    if (!out) return false;
+    out << "engine,size,vocabulary,records,status,load_ms,median_ms,p99_ms,mean_ms,qps,peak_rss_kb\n";
+    out << fixed << setprecision(4);
+    for (const CaseRow &row : rows) {
+        const CaseResult &r = row.result;
+        out << ENGINE_CATALOG[row.engine].key << ',' << row.size << ',' << row.vocabulary << ',' << r.records << ',' << r.status << ','
+            << r.loadMs << ',' << r.medianMs << ',' << r.p99Ms << ',' << r.meanMs << ',' << r.qps << ','
+            << r.peakRssKB << '\n';
+    }
+    return (bool)out;
+}
+
+// Keys and status strings are plain ASCII, so nothing needs escaping
+static bool writeJson(const string &path, const vector<CaseRow> &rows, const Options &options) {
+    ofstream out(path);
+    if (!out) return false;
+    out << fixed << setprecision(4);
+    out << "{\n  \"warmup\": " << options.warmup << ",\n  \"reps\": " << options.reps
+        << ",\n  \"ranking\": \"" << Ranking::name(options.ranking) << "\",\n  \"query_cache\": " << options.queryCache
+        << ",\n  \"results\": [";
+    for (size_t i = 0; i < rows.size(); i++) {
+        const CaseResult &r = rows[i].result;
+        out << (i ? ",\n" : "\n")
+            << "    {\"engine\": \"" << ENGINE_CATALOG[rows[i].engine].key << "\", \"size\": " << rows[i].size
+            << ", \"vocabulary\": " << rows[i].vocabulary
+            << ", \"records\": " << r.records << ", \"status\": \"" << r.status << "\""
+            << ", \"load_ms\": " << r.loadMs << ", \"median_ms\": " << r.medianMs
+            << ", \"p99_ms\": " << r.p99Ms << ", \"mean_ms\": " << r.meanMs
+            << ", \"qps\": " << r.qps << ", \"peak_rss_kb\": " << r.peakRssKB << "}";
+    }
+    out << "\n  ]\n}\n";
+    return (bool)out;
+}
+
+int main(int argc, char* argv[]) {
+    ThreadPool::configure(ThreadPool::threadsFromArgs(argc, argv));
+
+    Options options;
+    if (!parseArgs(argc, argv, options)) {
+        cerr << "Usage: " << argv[0] << " [--sizes 1K,10K,...] [--vocabularies 29,1K,...] [--engines all|hr|js|KEY,...]\n"
+             << "       [--warmup N] [--reps N] [--budget-ms MS] [--timeout SEC]\n"
+             << "       [--data-dir DIR] [--csv FILE] [--json FILE] [--threads N]\n"
+             << "       [--ranking auto|sort|counting] [--query-cache N]\n"
+             << "Engines:";
+        for (int e = 0; e < ENGINE_COUNT; e++) cerr << ' ' << ENGINE_CATALOG[e].key;
+        cerr << endl;
+        return 1;
+    }
+    Ranking::configure(options.ranking);   // inherited by every child
+    QueryCache::configure(options.queryCache);
+
+    vector<BenchQuery> hrQueries = loadQueries(true);
+    vector<BenchQuery> jsQueries = loadQueries(false);
+    if (hrQueries.empty() || jsQueries.empty()) {
+        cerr << "No queries: cannot read " << DEFAULT_JOBS_FILE << endl;
+        return 1;
+    }
+    if (mkdir(options.dataDir.c_str(), 0755) != 0 && errno != EEXIST) {
+        cerr << "Cannot create " << options.dataDir << endl;
+        return 1;
+    }
+
+    cout << "Warmup " << options.warmup << ", " << options.reps << " timed queries per case, budget "
+         << options.budgetMs << " ms per case, " << Ranking::name(options.ranking) << " ranking";
+    if (options.queryCache > 0) cout << ", query cache of " << options.queryCache << " entries";
+    cout << "\n\n";
+    printHeader();
+
+    vector<CaseRow> rows;
+    for (int vocabulary : options.vocabularies) {
+        bool overBudget[ENGINE_COUNT] = {};   // per vocabulary: a larger one can be slower
+        for (int size : options.sizes) {
+            string candidatesFile = datasetPath(options, "candidates", size, vocabulary);
+            string jobsFile = datasetPath(options, "jobs", size, vocabulary);
+            bool candidatesReady = false, jobsReady = false;
+
+            for (int e = 0; e < ENGINE_COUNT; e++) {
+                if (!options.selected[e]) continue;
+                const EngineEntry &entry = ENGINE_CATALOG[e];
+                CaseRow row = { e, size, vocabulary, {} };
+
+                if (overBudget[e]) {
+                    setStatus(row.result, "skipped");
+                } else {
+                    bool ready;
+                    if (entry.hr) {
+                        ready = candidatesReady = candidatesReady || generateDataset(candidatesFile, size, vocabulary, true);
+                    } else {
+                        ready = jobsReady = jobsReady || generateDataset(jobsFile, size, vocabulary, false);
+                    }
+
+                    if (!ready) {
+                        setStatus(row.result, "load-failed");
+                    } else {
+                        auto start = steady_clock::now();
+                        row.result = entry.hr
+                            ? runCase(entry, size, DEFAULT_JOBS_FILE, candidatesFile, hrQueries, options)
+                            : runCase(entry, size, jobsFile, DEFAULT_CANDIDATES_FILE, jsQueries, options);
+                        double elapsed = duration<double, milli>(steady_clock::now() - start).count();
+                        overBudget[e] = elapsed > options.budgetMs || strcmp(row.result.status, "timeout") == 0;
+                    }
+                }
+
+                rows.push_back(row);
+                printRow(row);
+            }
+        }
+    }
+
+    if (!options.csvPath.empty() && !writeCsv(options.csvPath, rows))
+        cerr << "Cannot write " << options.csvPath << endl;
+    if (!options.jsonPath.empty() && !writeJson(options.jsonPath, rows, options))
+        cerr << "Cannot write " << options.jsonPath << endl;
+    return 0;
+}
@@ -0,0 +1,94 @@
+// Synthetic dataset generator for scale testing. Writes cleaned files in
+// the engines' formats, or raw text for the data cleaners, one row at a
+// time, so 100M-row files need no more memory than 1K-row ones.
+//
+//   candidates        like resume/candidates.csv
+//   jobs              like job_description/mergejob.csv
+//   resumes           like resume/resume.csv (input of data_cleaning_resume)
+//   job-descriptions  like job_description/job_description.csv
+//
+// Usage: ./GenerateData KIND --rows N --out FILE [--vocabulary N]
+//                       [--min-skills N] [--max-skills N]
+//                       [--distribution uniform|zipf] [--zipf-s X] [--seed N]
+// Counts accept K and M suffixes (10K, 100M). Defaults: 29 skills (the
+// cleaners' vocabulary), 2-6 skills per record, Zipf with s = 1, seed 42.
+//
+// Build from the repository root:
+//   g++ -std=c++17 -O2 GenerateData.cpp ./common/DatasetGenerator.cpp -o GenerateData
+#include <iostream>
+#include <string>
+#include <cstdlib>
+#include "common/DatasetGenerator.hpp"
+
+using namespace std;
+
+static void printUsage(const char* program) {
+    cerr << "Usage: " << program << " candidates|jobs|resumes|job-descriptions --rows N --out FILE\n"
+         << "       [--vocabulary N] [--min-skills N] [--max-skills N]\n"
+         << "       [--distribution uniform|zipf] [--zipf-s X] [--seed N]" << endl;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    string kind = argv[1];
+    string outPath;
+    GeneratorOptions options;
+    bool valid = kind == "candidates" || kind == "jobs" || kind == "resumes" || kind == "job-descriptions";
+
+    for (int i = 2; i < argc && valid; i++) {
+        string arg = argv[i];
+        if (i + 1 >= argc) {
+            valid = false;
+            break;
+        }
+        string value = argv[++i];
+
+        if (arg == "--rows") {
+            options.rows = DatasetGenerator::parseCount(value);
+            valid = options.rows > 0;
+        } else if (arg == "--out") {
+            outPath = value;
+        } else if (arg == "--vocabulary") {
+            options.vocabularySize = (int)DatasetGenerator::parseCount(value);
+            valid = options.vocabularySize > 0 && options.vocabularySize <= MAX_VOCABULARY_SIZE;
+        } else if (arg == "--min-skills") {
+            options.minSkills = atoi(value.c_str());
+            valid = options.minSkills >= 1 && options.minSkills <= MAX_GENERATED_SKILLS;
+        } else if (arg == "--max-skills") {
+            options.maxSkills = atoi(value.c_str());
+            valid = options.maxSkills >= 1 && options.maxSkills <= MAX_GENERATED_SKILLS;
+        } else if (arg == "--distribution") {
+            valid = value == "uniform" || value == "zipf";
+            options.distribution = (value == "uniform") ? SKILLS_UNIFORM : SKILLS_ZIPF;
+        } else if (arg == "--zipf-s") {
+            options.zipfExponent = atof(value.c_str());
+            valid = options.zipfExponent > 0.0;
+        } else if (arg == "--seed") {
+            options.seed = strtoull(value.c_str(), nullptr, 10);
+        } else {
+            valid = false;
+        }
+    }
+    if (!valid || outPath.empty() || options.minSkills > options.maxSkills) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    DatasetGenerator generator(options);
+    bool written;
+    if (kind == "candidates") written = generator.writeCandidates(outPath);
+    else if (kind == "jobs") written = generator.writeJobs(outPath);
+    else if (kind == "resumes") written = generator.writeResumes(outPath);
+    else written = generator.writeJobDescriptions(outPath);
+
+    if (!written) {
+        cerr << "Cannot write " << outPath << endl;
+        return 1;
+    }
+    cout << "Wrote " << options.rows << " " << kind << " rows to " << outPath << endl;
+    return 0;
+}
@@ -1,68 +1,59 @@
+// Single launcher for all eight engines. Every engine is linked in and
+// loads its datasets the first time it is chosen; choosing it again reuses
+// the data already in memory.
+//
+// The engines do not share one loaded dataset. Only the skill dictionary is
+// shared: skill names are interned once into SkillDictionary::global(). Each
+// engine otherwise reads the job and candidate files itself into its own
+// structures, so the first switch to another role, algorithm or container
+// rereads them from disk (candidates.bin when it is current), and every
+// engine chosen so far keeps its own copy resident until exit.
+//
+// Build from the repository root as one command (string_view needs C++17,
+// the thread pool needs -pthread):
+//   g++ -std=c++17 -DENGINE_NO_MAIN Main.cpp
+//       ./Array_Jing/Array_HR/InsertionBinary_HR.cpp ./Array_Xin/HR/MergeJump_HR.cpp
+//       ./linked_list/hr/LinearInsertion_HR.cpp ./linked_list/hr/OptimizedMerge_HR.cpp
+//       ./Array_Jing/Array_jobseeker/InsertionBinary_JobSeeker.cpp ./Array_Xin/Job_Seeker/MergeJump_JobSeeker.cpp
+//       ./linked_list/job_seeker/LinearInsertion_JobSeeker.cpp ./linked_list/job_seeker/OptimizedMerge_JobSeeker.cpp
+//       ./common/CsvLoader.cpp ./common/SkillDictionary.cpp ./common/SkillBitset.cpp ./common/ScoringKernel.cpp
+//       ./common/SkillIndex.cpp ./common/ThreadPool.cpp ./common/Snapshot.cpp ./common/MemoryStats.cpp
+//       ./common/AllocStats.cpp ./common/NodeArena.cpp ./common/CountingRank.cpp ./common/MatchCache.cpp
+//       ./common/QueryCache.cpp -pthread -o JobMatching
+// Add -DTRACK_ALLOCATIONS to count heap traffic per phase in the
+// performance summaries. Run with --threads N to size the thread pool,
+// --ranking auto|sort|counting to choose how matches are ranked and
+// --query-cache N to size the HR engines' result caches (0 turns them off).
 #include <iostream>
 #include <string>
-#include <cstdlib>   // for system()
 #include <limits>
 #include <algorithm>
+#include "common/Engine.hpp"
+#include "common/EngineCatalog.hpp"
+#include "common/AllocStats.hpp"
+#include "common/ThreadPool.hpp"
+#include "common/CountingRank.hpp"
+#include "common/QueryCache.hpp"
 
 using namespace std;
 
-// Function to get compile/run commands based on role, structure, algorithm
-void getCompileRunCommands(const string &role, const string &structure, const string &algorithm,
-                           string &compileCmd, string &runCmd) {
-#ifdef _WIN32
-    string exeExt = ".exe";
-#else
-    string exeExt = "";
-#endif
-
-    if (role == "hr") {
-        if (structure == "array") {
-            if (algorithm == "1") {
-                cout << "\nRunning Array Insertion Sort and Binary Search (HR)\n";
-                compileCmd = "g++ ./Array_Jing/Array_HR/InsertionBinary_HR.cpp -o HR" + exeExt;
-            } else {
-                cout << "\nRunning Array Merge Sort and Jump Search (HR)\n";
-                compileCmd = "g++ ./Array_Xin/HR/MergeJump_HR.cpp -o HR" + exeExt;
-            }
-            runCmd = "HR" + exeExt;
-        } else { // linked list
-            if (algorithm == "1") {
-                cout << "\nRunning Linked List Insertion Sort and Linear Search (HR)\n";
-                compileCmd = "g++ ./linked_list/hr/LinearInsertion_HR.cpp -o HR" + exeExt;
-            } else {
-                cout << "\nRunning Linked List Merge Sort and Optimized Linear Search (HR)\n";
-                compileCmd = "g++ ./linked_list/hr/OptimizedMerge_HR.cpp -o HR" + exeExt;
-            }
-            runCmd = "HR" + exeExt;
-        }
-    } else { // job seeker
-        if (structure == "array") {
-            if (algorithm == "1") {
-                cout << "\nRunning Array Insertion Sort and Binary Search (Job Seeker)\n";
-                compileCmd = "g++ ./Array_Jing/Array_jobseeker/InsertionBinary_JobSeeker.cpp -o JobSeeker" + exeExt;
-            } else {
-                cout << "\nRunning Array Merge Sort and Jump Search (Job Seeker)\n";
-                compileCmd = "g++ ./Array_Xin/Job_Seeker/MergeJump_JobSeeker.cpp -o JobSeeker" + exeExt;
-            }
-            runCmd = "JobSeeker" + exeExt;
-        } else { // linked list
-            if (algorithm == "1") {
-                cout << "\nRunning Linked List Insertion Sort and Linear Search (Job Seeker)\n";
-                compileCmd = "g++ ./linked_list/job_seeker/LinearInsertion_JobSeeker.cpp -o JobSeeker" + exeExt;
-            } else {
-                cout << "\nRunning Linked List Merge Sort and Optimized Linear Search (Job Seeker)\n";
-                compileCmd = "g++ ./linked_list/job_seeker/OptimizedMerge_JobSeeker.cpp -o JobSeeker" + exeExt;
-            }
-            runCmd = "JobSeeker" + exeExt;
-        }
-    }
-
-#ifndef _WIN32
-    runCmd = "./" + runCmd; // Unix-style prefix
-#endif
+// Position in ENGINE_CATALOG
+int engineIndex(const string &role, const string &structure, const string &algorithm) {
+    int index = (role == "hr") ? 0 : 4;
+    if (structure != "array") index += 2;
+    if (algorithm != "1") index += 1;
+    return index;
 }
 
-int main() {
+int main(int argc, char* argv[]) {
+    ThreadPool::configure(ThreadPool::threadsFromArgs(argc, argv));
+    Ranking::configure(Ranking::modeFromArgs(argc, argv));
+    QueryCache::configure(QueryCache::capacityFromArgs(argc, argv));
+
+    // Created and loaded on first use, kept for the rest of the run
+    Engine* engines[ENGINE_COUNT] = {};
+    bool loaded[ENGINE_COUNT] = {};
+
     while (true) {
         cout << "=========================================\n";
         cout << "      Welcome to Job Matching System\n";
@@ -128,23 +119,26 @@ int main() {
 
         cout << "\n-----------------------------------------\n";
 
-        string compileCmd, runCmd;
-        getCompileRunCommands(role, structure, algorithm, compileCmd, runCmd);
+        int index = engineIndex(role, structure, algorithm);
+        if (!engines[index]) engines[index] = ENGINE_CATALOG[index].create();
+        Engine* engine = engines[index];
+        cout << "\nRunning " << engine->name() << "\n";
 
-        cout << "\nCompiling selected module...\n";
-        int compileResult = system(compileCmd.c_str());
-        if (compileResult != 0) {
-            cout << "Compilation failed. Check file paths and syntax.\n";
-            continue;
+        if (!loaded[index]) {
+            cout << "\nLoading data...\n";
+            AllocScope loading(ALLOC_LOAD);
+            loaded[index] = engine->load();
         }
-
-        cout << "\nExecuting module...\n";
-        int runResult = system(runCmd.c_str());
-        if (runResult != 0) {
-            cout << "Error running the selected module.\n";
+        if (loaded[index]) {
+            engine->query();
+        } else {
+            // Start from a fresh engine if it is chosen again
+            cout << "Error loading the selected module. Check the data files.\n";
+            delete engine;
+            engines[index] = nullptr;
         }
 
-        // After execution: loop menu
+        // After the session: loop menu
         int menuChoice;
         while (true) {
             cout << "\nDo you want to:\n";
@@ -168,5 +162,6 @@ int main() {
         cout << "\n";
     }
 
+    for (int i = 0; i < ENGINE_COUNT; i++) delete engines[i];
     return 0;
 }
\ No newline at end of file
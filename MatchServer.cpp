@@ -0,0 +1,447 @@
+// Match daemon: loads the jobs and candidates once, then answers HR and job
+// seeker queries over a local Unix domain socket, so callers no longer drive
+// the interactive programs and reload the CSVs on every search.
+//
+// Protocol: one request per line, fields separated by '|', lists by ','.
+//   HR|<job title>|<skill>:<weight>,<skill>:<weight>,...   weights 1-10
+//   JS|<skill>,<skill>,...                                 at most 20 skills
+//   PING
+// Each request gets "OK <rows>" followed by that many rows, or one
+// "ERR <reason>" line.
+//   HR rows: candidate|matched skills|weighted score|score %    (top 5)
+//   JS rows: job title|matched skills|weighted score|percentage (top 3)
+//
+// HR queries are ranked by the linked list Optimized Linear Search + Merge
+// Sort engine (Matcher::rankCandidates), job seeker queries by the array
+// Binary Search + Insertion Sort engine (JobMatcher::matchSkillsWeighted).
+// Requests are answered one at a time, since both engines rank in place;
+// replies are queued per client and written as its socket accepts them.
+// The socket path is only taken over from a server that no longer answers.
+// HR replies are kept in an LRU query cache (--query-cache N entries, 0 for
+// none), so a repeated job, skill set and weights is answered without
+// ranking; the hit and miss counts are printed when the server stops.
+//
+// Serve:  ./MatchServer [--socket PATH] [--ranking auto|sort|counting] [--query-cache N]
+// Query:  ./MatchServer [--socket PATH] --query 'JS|Python,SQL'
+//
+// Build from the repository root (Linux / POSIX only):
+//   g++ -std=c++17 -DENGINE_NO_MAIN MatchServer.cpp
+//       ./linked_list/hr/OptimizedMerge_HR.cpp ./Array_Jing/Array_jobseeker/InsertionBinary_JobSeeker.cpp
+//       ./common/CsvLoader.cpp ./common/SkillDictionary.cpp ./common/SkillBitset.cpp ./common/ScoringKernel.cpp
+//       ./common/SkillIndex.cpp ./common/ThreadPool.cpp ./common/Snapshot.cpp ./common/MemoryStats.cpp
+//       ./common/AllocStats.cpp ./common/NodeArena.cpp ./common/CountingRank.cpp ./common/MatchCache.cpp
+//       ./common/QueryCache.cpp -pthread -o MatchServer
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <iomanip>
+#include <cstring>
+#include <cstdlib>
+#include <cerrno>
+#include <csignal>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "linked_list/hr/OptimizedMerge_HR.hpp"
+#include "Array_Jing/Array_jobseeker/InsertionBinary_JobSeeker.hpp"
+
+using namespace std;
+
+// ---------- Constants ----------
+const char* DEFAULT_SOCKET = "/tmp/jobmatch.sock";
+const int MAX_CLIENTS = 64;
+const size_t MAX_REQUEST = 64 * 1024;   // longest line accepted before a newline
+const int MAX_QUERY_SKILLS = 20;
+
+// ---------- Loaded Data ----------
+struct MatchData {
+    NodeArena nodes;   // the HR role and candidate lists
+    optimized_merge_hr::JobRole* roles = nullptr;
+    optimized_merge_hr::CandidateIndex pool;
+    insertion_binary_jobseeker::JobMatcher* matcher = nullptr;
+
+    ~MatchData() { delete matcher; }
+};
+
+static volatile sig_atomic_t stopRequested = 0;
+
+static void onStopSignal(int) {
+    stopRequested = 1;
+}
+
+// ---------- Parsing Helpers ----------
+static string trimField(const string &s) {
+    size_t start = s.find_first_not_of(" \t\r\n");
+    size_t end = s.find_last_not_of(" \t\r\n");
+    return (start == string::npos) ? "" : s.substr(start, end - start + 1);
+}
+
+// Splits on sep into out[] (room for max entries); returns the count, or -1
+// when there are more than max
+static int splitFields(const string &line, char sep, string out[], int max) {
+    int count = 0;
+    size_t start = 0;
+    while (true) {
+        size_t end = line.find(sep, start);
+        if (count == max) return -1;
+        out[count++] = line.substr(start, end == string::npos ? string::npos : end - start);
+        if (end == string::npos) break;
+        start = end + 1;
+    }
+    return count;
+}
+
+static string errorReply(const string &reason) {
+    return "ERR " + reason + "\n";
+}
+
+// ---------- Request Handlers ----------
+static string handleHR(MatchData &data, const string &title, const string &skillList) {
+    using namespace optimized_merge_hr;
+
+    JobRole* role = OptimizedLinearSearch::findRole(data.roles, trimField(title));
+    if (!role) return errorReply("unknown job '" + trimField(title) + "'");
+
+    string items[MAX_QUERY_SKILLS];
+    int itemCount = splitFields(skillList, ',', items, MAX_QUERY_SKILLS);
+    if (itemCount < 0) return errorReply("too many skills");
+
+    SkillId ids[MAX_QUERY_SKILLS];
+    int weights[MAX_QUERY_SKILLS];
+    int count = 0;
+    for (int i = 0; i < itemCount; i++) {
+        size_t colon = items[i].rfind(':');
+        if (colon == string::npos) return errorReply("expected skill:weight, got '" + trimField(items[i]) + "'");
+        string name = trimField(items[i].substr(0, colon));
+        stringstream weightIn(items[i].substr(colon + 1));
+        int weight;
+        if (!(weightIn >> weight) || !(weightIn >> ws).eof() || weight < 1 || weight > 10)
+            return errorReply("weight for '" + name + "' must be 1-10");
+
+        SkillId id = SkillDictionary::global().find(name);
+        if (id == INVALID_SKILL) return errorReply("unknown skill '" + name + "'");
+        bool repeated = false;
+        for (int k = 0; k < count; k++) repeated = repeated || ids[k] == id;
+        if (repeated) continue;
+        ids[count] = id;
+        weights[count] = weight;
+        count++;
+    }
+    if (count == 0) return errorReply("no skills given");
+
+    CachedResult result;
+    Matcher::rankCached(role, data.pool, ids, weights, count, result);
+
+    ostringstream rows;
+    rows << fixed << setprecision(2);
+    for (int i = 0; i < result.rowCount; i++) {
+        const CachedRow &c = result.rows[i];
+        rows << c.name << '|' << c.matchedSkills << '|' << c.matchedWeight << '|' << c.score << '\n';
+    }
+    return "OK " + to_string(result.rowCount) + "\n" + rows.str();
+}
+
+static string handleJobSeeker(MatchData &data, const string &skillList) {
+    using namespace insertion_binary_jobseeker;
+
+    string skills[MAX_QUERY_SKILLS];
+    int count = splitFields(skillList, ',', skills, MAX_QUERY_SKILLS);
+    if (count < 0) return errorReply("too many skills (max 20)");
+
+    JobMatcher &jm = *data.matcher;
+    jm.setSeekerSkills(skills, count);
+    if (jm.getSeekerSkillCount() == 0) return errorReply("no skills given");
+    jm.matchSkillsWeighted();
+
+    // Same ranking as the interactive session
+    JobJS* matches = new JobJS[jm.getJobCount() > 0 ? jm.getJobCount() : 1];
+    int matchedCount = jm.collectMatches(matches);
+    JobMatcher::rankJobsArray(matches, matchedCount);
+
+    int shown = matchedCount < TOP_JOBS ? matchedCount : TOP_JOBS;
+    ostringstream rows;
+    rows << fixed << setprecision(2);
+    for (int i = 0; i < shown; i++)
+        rows << matches[i].title << '|' << matches[i].matched << '|' << matches[i].weightedScore << '|' << matches[i].percentage << '\n';
+    delete[] matches;
+    return "OK " + to_string(shown) + "\n" + rows.str();
+}
+
+static string handleRequest(MatchData &data, const string &line) {
+    string fields[3];
+    int count = splitFields(line, '|', fields, 3);
+    string kind = count > 0 ? trimField(fields[0]) : "";
+
+    if (kind == "PING" && count == 1) return "OK 0\n";
+    if (kind == "HR" && count == 3) return handleHR(data, fields[1], fields[2]);
+    if (kind == "JS" && count == 2) return handleJobSeeker(data, fields[1]);
+    return errorReply("expected HR|job|skill:weight,... or JS|skill,... or PING");
+}
+
+// ---------- Socket Helpers ----------
+static bool makeAddress(const string &path, sockaddr_un &addr) {
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(addr.sun_path)) {
+        cerr << "Error: socket path too long: " << path << endl;
+        return false;
+    }
+    memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+    return true;
+}
+
+static bool sendAll(int fd, const string &bytes) {
+    size_t sent = 0;
+    while (sent < bytes.size()) {
+        ssize_t n = send(fd, bytes.data() + sent, bytes.size() - sent, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        sent += (size_t)n;
+    }
+    return true;
+}
+
+// ---------- Server ----------
+static bool loadData(MatchData &data) {
+    using namespace optimized_merge_hr;
+
+    data.roles = FileLoader::loadJobs("job_description/mergejob.csv", data.nodes);
+    Candidate* candidates = FileLoader::loadCandidates("resume/candidates.csv", data.nodes);
+    if (!data.roles || !candidates) return false;
+    FileLoader::indexCandidates(candidates, data.pool);
+
+    data.matcher = new insertion_binary_jobseeker::JobMatcher();
+    return data.matcher->loadJobs("job_description/mergejob.csv");
+}
+
+// Takes the socket path for bind(): a socket left behind by a server that
+// is gone is removed, anything else there (a regular file, or a socket
+// another server still answers on) is left alone and refused
+static bool claimSocketPath(const string &path, const sockaddr_un &addr) {
+    struct stat st;
+    if (lstat(path.c_str(), &st) != 0) return true;   // nothing there yet
+    if (!S_ISSOCK(st.st_mode)) {
+        cerr << "Error: " << path << " exists and is not a socket" << endl;
+        return false;
+    }
+
+    int probe = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (probe < 0) {
+        cerr << "Error: socket: " << strerror(errno) << endl;
+        return false;
+    }
+    bool answered = connect(probe, (const sockaddr*)&addr, sizeof(addr)) == 0;
+    int probeError = errno;
+    close(probe);
+    if (answered) {
+        cerr << "Error: a server is already listening on " << path << endl;
+        return false;
+    }
+    if (probeError != ECONNREFUSED) {
+        cerr << "Error: cannot probe " << path << ": " << strerror(probeError) << endl;
+        return false;
+    }
+    unlink(path.c_str());   // stale socket from an earlier run
+    return true;
+}
+
+// Writes as much of out as the socket takes without blocking and drops it
+// from out; false when the client is gone
+static bool flushOutput(int fd, string &out) {
+    size_t sent = 0;
+    while (sent < out.size()) {
+        ssize_t n = send(fd, out.data() + sent, out.size() - sent, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+        if (n <= 0) return false;
+        sent += (size_t)n;
+    }
+    out.erase(0, sent);
+    return true;
+}
+
+static int serve(const string &path) {
+    MatchData data;
+    if (!loadData(data)) {
+        cerr << "Error: CSV files not found or empty." << endl;
+        return 1;
+    }
+
+    sockaddr_un addr;
+    if (!makeAddress(path, addr)) return 1;
+    if (!claimSocketPath(path, addr)) return 1;
+    int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener < 0) {
+        cerr << "Error: socket: " << strerror(errno) << endl;
+        return 1;
+    }
+    if (bind(listener, (sockaddr*)&addr, sizeof(addr)) < 0 || listen(listener, 16) < 0) {
+        cerr << "Error: cannot listen on " << path << ": " << strerror(errno) << endl;
+        close(listener);
+        return 1;
+    }
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = onStopSignal;   // no SA_RESTART, so poll() wakes up
+    sigaction(SIGINT, &action, nullptr);
+    sigaction(SIGTERM, &action, nullptr);
+
+    cout << "Listening on " << path << " (" << data.pool.count << " candidates, "
+         << data.matcher->getJobCount() << " jobs)" << endl;
+
+    // Slot 0 is the listener; slots 1.. are clients, fd -1 when free.
+    // Client sockets never block: replies wait in outgoing[] until POLLOUT,
+    // and a client is not read again until it has taken its replies, so one
+    // that pipelines requests without reading only stalls itself.
+    pollfd fds[MAX_CLIENTS + 1];
+    string pending[MAX_CLIENTS + 1];
+    string outgoing[MAX_CLIENTS + 1];
+    bool closing[MAX_CLIENTS + 1];   // close once outgoing is flushed
+    fds[0].fd = listener;
+    fds[0].events = POLLIN;
+    for (int i = 1; i <= MAX_CLIENTS; i++) {
+        fds[i].fd = -1;
+        fds[i].events = POLLIN;
+        closing[i] = false;
+    }
+
+    char buffer[4096];
+    while (!stopRequested) {
+        for (int i = 1; i <= MAX_CLIENTS; i++)
+            fds[i].events = outgoing[i].empty() ? POLLIN : POLLOUT;
+        if (poll(fds, MAX_CLIENTS + 1, -1) < 0) {
+            if (errno == EINTR) continue;
+            cerr << "Error: poll: " << strerror(errno) << endl;
+            break;
+        }
+
+        if (fds[0].revents & POLLIN) {
+            int client = accept(listener, nullptr, nullptr);
+            if (client >= 0) {
+                fcntl(client, F_SETFL, fcntl(client, F_GETFL) | O_NONBLOCK);
+                int slot = 1;
+                while (slot <= MAX_CLIENTS && fds[slot].fd != -1) slot++;
+                if (slot > MAX_CLIENTS) {
+                    string busy = errorReply("server busy");
+                    flushOutput(client, busy);
+                    close(client);
+                } else {
+                    fds[slot].fd = client;
+                    fds[slot].revents = 0;
+                    pending[slot].clear();
+                    outgoing[slot].clear();
+                    closing[slot] = false;
+                }
+            }
+        }
+
+        for (int i = 1; i <= MAX_CLIENTS; i++) {
+            if (fds[i].fd == -1) continue;
+            bool open = true;
+
+            if (fds[i].revents & POLLOUT) {
+                open = flushOutput(fds[i].fd, outgoing[i]);
+            } else if (fds[i].revents & (POLLIN | POLLHUP | POLLERR)) {
+                ssize_t n = recv(fds[i].fd, buffer, sizeof(buffer), 0);
+                if (n < 0 && (errno == EINTR || errno == EAGAIN || errno == EWOULDBLOCK)) continue;
+                if (n > 0) pending[i].append(buffer, (size_t)n);
+                else closing[i] = true;   // end of requests: answer what came, then close
+
+                size_t newline;
+                while ((newline = pending[i].find('\n')) != string::npos) {
+                    string line = pending[i].substr(0, newline);
+                    pending[i].erase(0, newline + 1);
+                    if (!line.empty() && line.back() == '\r') line.pop_back();
+                    if (trimField(line).empty()) continue;
+                    outgoing[i] += handleRequest(data, line);
+                }
+                if (pending[i].size() > MAX_REQUEST) {
+                    outgoing[i] += errorReply("request too long");
+                    closing[i] = true;
+                }
+                open = flushOutput(fds[i].fd, outgoing[i]);
+            }
+
+            if (!open || (closing[i] && outgoing[i].empty())) {
+                close(fds[i].fd);
+                fds[i].fd = -1;
+                pending[i].clear();
+                outgoing[i].clear();
+                closing[i] = false;
+            }
+        }
+    }
+
+    for (int i = 1; i <= MAX_CLIENTS; i++)
+        if (fds[i].fd != -1) close(fds[i].fd);
+    close(listener);
+    unlink(path.c_str());
+    if (data.pool.results.enabled())
+        cout << "Query cache: " << data.pool.results.hits() << " hits, " << data.pool.results.misses() << " misses" << endl;
+    cout << "Server stopped." << endl;
+    return 0;
+}
+
+// ---------- Client ----------
+// Sends one request and prints the reply; exit status 0 only for "OK"
+static int query(const string &path, const string &request) {
+    sockaddr_un addr;
+    if (!makeAddress(path, addr)) return 1;
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || connect(fd, (sockaddr*)&addr, sizeof(addr)) < 0) {
+        cerr << "Error: cannot connect to " << path << ": " << strerror(errno) << endl;
+        if (fd >= 0) close(fd);
+        return 1;
+    }
+
+    if (!sendAll(fd, request + "\n")) {
+        close(fd);
+        return 1;
+    }
+    shutdown(fd, SHUT_WR);
+
+    string reply;
+    char buffer[4096];
+    ssize_t n;
+    while ((n = recv(fd, buffer, sizeof(buffer), 0)) > 0)
+        reply.append(buffer, (size_t)n);
+    close(fd);
+
+    cout << reply;
+    return reply.compare(0, 3, "OK ") == 0 ? 0 : 1;
+}
+
+int main(int argc, char* argv[]) {
+    string path = DEFAULT_SOCKET;
+    string request;
+    bool isClient = false;
+
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "--socket" && i + 1 < argc) {
+            path = argv[++i];
+        } else if (arg == "--query" && i + 1 < argc) {
+            request = argv[++i];
+            isClient = true;
+        } else if (arg == "--ranking" && i + 1 < argc) {
+            RankingMode mode;
+            if (!Ranking::parse(argv[++i], mode)) {
+                cerr << "Unknown ranking mode " << argv[i] << endl;
+                return 1;
+            }
+            Ranking::configure(mode);
+        } else if (arg == "--query-cache" && i + 1 < argc) {
+            QueryCache::configure(atoi(argv[++i]));
+        } else {
+            cerr << "Usage: " << argv[0] << " [--socket PATH] [--ranking auto|sort|counting] [--query-cache N]"
+                 << " [--query REQUEST]" << endl;
+            return 1;
+        }
+    }
+
+    return isClient ? query(path, request) : serve(path);
+}
@@ -0,0 +1,152 @@
+#include "AllocStats.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <iostream>
+#include <iomanip>
+
+// Phase counters are plain zero-initialised atomics so that allocations made
+// during static initialisation, before main(), are counted safely
+static atomic<int> currentPhase;
+static atomic<size_t> allocationCount[ALLOC_PHASE_COUNT];
+static atomic<size_t> freeCount[ALLOC_PHASE_COUNT];
+static atomic<size_t> requestedBytes[ALLOC_PHASE_COUNT];
+static atomic<size_t> liveBytes[ALLOC_PHASE_COUNT];
+static atomic<size_t> peakLiveBytes[ALLOC_PHASE_COUNT];
+
+// ---------- Phases ----------
+bool AllocStats::enabled() {
+#ifdef TRACK_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+AllocPhase AllocStats::enter(AllocPhase phase) {
+    return (AllocPhase)currentPhase.exchange(phase, memory_order_relaxed);
+}
+
+void AllocStats::leave(AllocPhase previous) {
+    currentPhase.store(previous, memory_order_relaxed);
+}
+
+AllocCounters AllocStats::counters(AllocPhase phase) {
+    AllocCounters snapshot;
+    snapshot.allocations = allocationCount[phase].load(memory_order_relaxed);
+    snapshot.frees = freeCount[phase].load(memory_order_relaxed);
+    snapshot.bytes = requestedBytes[phase].load(memory_order_relaxed);
+    snapshot.liveBytes = liveBytes[phase].load(memory_order_relaxed);
+    snapshot.peakLiveBytes = peakLiveBytes[phase].load(memory_order_relaxed);
+    return snapshot;
+}
+
+const char* AllocStats::phaseName(AllocPhase phase) {
+    switch (phase) {
+        case ALLOC_LOAD:    return "load";
+        case ALLOC_SEARCH:  return "search";
+        case ALLOC_SORT:    return "sort";
+        case ALLOC_DISPLAY: return "display";
+        default:            return "other";
+    }
+}
+
+// ---------- Report ----------
+void AllocStats::printReport() {
+    if (!enabled()) return;
+
+    // Snapshot first: printing allocates too
+    AllocCounters rows[ALLOC_PHASE_COUNT];
+    for (int p = 0; p < ALLOC_PHASE_COUNT; p++) rows[p] = counters((AllocPhase)p);
+
+    cout << "\n----- Heap Traffic (since start) -----\n";
+    cout << left << setw(10) << "Phase"
+         << right << setw(10) << "Allocs"
+         << setw(10) << "Frees"
+         << setw(14) << "Bytes"
+         << setw(14) << "Peak Live" << "\n";
+    // Named phases first, the catch-all last
+    const AllocPhase order[ALLOC_PHASE_COUNT] = { ALLOC_LOAD, ALLOC_SEARCH, ALLOC_SORT, ALLOC_DISPLAY, ALLOC_OTHER };
+    for (int i = 0; i < ALLOC_PHASE_COUNT; i++) {
+        const AllocCounters& row = rows[order[i]];
+        cout << left << setw(10) << phaseName(order[i])
+             << right << setw(10) << row.allocations
+             << setw(10) << row.frees
+             << setw(14) << row.bytes
+             << setw(14) << row.peakLiveBytes << "\n";
+    }
+    cout << left;
+}
+
+#ifdef TRACK_ALLOCATIONS
+// ---------- Counting operator new/delete ----------
+// Every block carries a header recording its size and the phase it was
+// charged to, so a free is credited back to the right phase even when it
+// happens later, in another phase. The union keeps the payload aligned the
+// way malloc() would have aligned it.
+union BlockHeader {
+    struct {
+        size_t size;
+        int phase;
+    } info;
+    max_align_t alignment;
+};
+
+static void* trackedAlloc(size_t size) {
+    void* raw;
+    while ((raw = malloc(sizeof(BlockHeader) + size)) == nullptr) {
+        new_handler handler = get_new_handler();
+        if (!handler) return nullptr;
+        handler();
+    }
+
+    int phase = currentPhase.load(memory_order_relaxed);
+    BlockHeader* header = (BlockHeader*)raw;
+    header->info.size = size;
+    header->info.phase = phase;
+
+    allocationCount[phase].fetch_add(1, memory_order_relaxed);
+    requestedBytes[phase].fetch_add(size, memory_order_relaxed);
+    size_t live = liveBytes[phase].fetch_add(size, memory_order_relaxed) + size;
+    size_t peak = peakLiveBytes[phase].load(memory_order_relaxed);
+    while (live > peak && !peakLiveBytes[phase].compare_exchange_weak(peak, live, memory_order_relaxed)) {}
+
+    return header + 1;
+}
+
+static void trackedFree(void* block) {
+    if (!block) return;
+    BlockHeader* header = (BlockHeader*)block - 1;
+    int phase = header->info.phase;
+    freeCount[phase].fetch_add(1, memory_order_relaxed);
+    liveBytes[phase].fetch_sub(header->info.size, memory_order_relaxed);
+    free(header);
+}
+
+void* operator new(size_t size) {
+    void* block = trackedAlloc(size);
+    if (!block) throw bad_alloc();
+    return block;
+}
+
+void* operator new[](size_t size) {
+    void* block = trackedAlloc(size);
+    if (!block) throw bad_alloc();
+    return block;
+}
+
+void* operator new(size_t size, const nothrow_t&) noexcept {
+    try { return trackedAlloc(size); } catch (...) { return nullptr; }
+}
+
+void* operator new[](size_t size, const nothrow_t&) noexcept {
+    try { return trackedAlloc(size); } catch (...) { return nullptr; }
+}
+
+void operator delete(void* block) noexcept { trackedFree(block); }
+void operator delete[](void* block) noexcept { trackedFree(block); }
+void operator delete(void* block, size_t) noexcept { trackedFree(block); }
+void operator delete[](void* block, size_t) noexcept { trackedFree(block); }
+void operator delete(void* block, const nothrow_t&) noexcept { trackedFree(block); }
+void operator delete[](void* block, const nothrow_t&) noexcept { trackedFree(block); }
+#endif
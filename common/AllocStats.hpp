@@ -0,0 +1,65 @@
+#ifndef ALLOCSTATS_HPP
+#define ALLOCSTATS_HPP
+
+#include <cstddef>
+using namespace std;
+
+// ---------- Allocation Phases ----------
+// What the program was doing when a block was allocated. Blocks allocated
+// outside any phase (menus, prompts) are counted under ALLOC_OTHER.
+enum AllocPhase {
+    ALLOC_OTHER,
+    ALLOC_LOAD,
+    ALLOC_SEARCH,
+    ALLOC_SORT,
+    ALLOC_DISPLAY,
+    ALLOC_PHASE_COUNT
+};
+
+struct AllocCounters {
+    size_t allocations;     // operator new calls
+    size_t frees;           // operator delete calls on blocks from this phase
+    size_t bytes;           // total bytes requested
+    size_t liveBytes;       // allocated in this phase and not yet freed
+    size_t peakLiveBytes;   // highest liveBytes seen
+};
+
+// ---------- Allocation Stats ----------
+// Opt-in heap traffic counters. Compiling common/AllocStats.cpp with
+// -DTRACK_ALLOCATIONS replaces the global operator new/delete with versions
+// that charge every block to the phase that was current when it was
+// allocated; without the flag nothing is replaced, the phases are only
+// tracked, and printReport() prints nothing.
+//
+// Counters accumulate for the whole process, so compare two builds by
+// running the same scripted session through both.
+class AllocStats {
+public:
+    static bool enabled();
+
+    // Makes phase current and returns the phase it replaced
+    static AllocPhase enter(AllocPhase phase);
+    static void leave(AllocPhase previous);
+
+    static AllocCounters counters(AllocPhase phase);
+    static const char* phaseName(AllocPhase phase);
+
+    // Per-phase table for the performance reports
+    static void printReport();
+};
+
+// ---------- Alloc Scope ----------
+// Charges every allocation made while it is alive to one phase
+class AllocScope {
+private:
+    AllocPhase previous;
+
+public:
+    explicit AllocScope(AllocPhase phase) : previous(AllocStats::enter(phase)) {}
+    ~AllocScope() { AllocStats::leave(previous); }
+
+    AllocScope(const AllocScope&) = delete;
+    AllocScope& operator=(const AllocScope&) = delete;
+};
+
+#endif // ALLOCSTATS_HPP
@@ -0,0 +1,70 @@
+#include "CountingRank.hpp"
+#include <cstring>
+
+RankingMode Ranking::current = RANK_AUTO;
+
+// ---------- Mode Selection ----------
+const char* Ranking::name(RankingMode mode) {
+    switch (mode) {
+        case RANK_SORT: return "sort";
+        case RANK_COUNTING: return "counting";
+        default: return "auto";
+    }
+}
+
+bool Ranking::parse(const char* text, RankingMode &mode) {
+    if (strcmp(text, "auto") == 0) mode = RANK_AUTO;
+    else if (strcmp(text, "sort") == 0) mode = RANK_SORT;
+    else if (strcmp(text, "counting") == 0) mode = RANK_COUNTING;
+    else return false;
+    return true;
+}
+
+RankingMode Ranking::modeFromArgs(int argc, char* argv[]) {
+    RankingMode mode = RANK_AUTO;
+    for (int i = 1; i + 1 < argc; i++) {
+        if (strcmp(argv[i], "--ranking") == 0 && parse(argv[i + 1], mode)) break;
+    }
+    return mode;
+}
+
+// ---------- Radix Passes ----------
+// Ranks on maxKey - key, ascending, which is the key descending with ties
+// still in input order
+void CountingRank::rank(const uint64_t keys[], int n, int order[]) {
+    for (int i = 0; i < n; i++) order[i] = i;
+    if (n < 2) return;
+
+    uint64_t maxKey = 0;
+    for (int i = 0; i < n; i++)
+        if (keys[i] > maxKey) maxKey = keys[i];
+
+    int* buffer = new int[n];
+    int* from = order;
+    int* to = buffer;
+    int* count = new int[BUCKETS];
+
+    for (int shift = 0; shift < 64 && (shift == 0 || (maxKey >> shift) > 0); shift += DIGIT_BITS) {
+        memset(count, 0, BUCKETS * sizeof(int));
+        for (int i = 0; i < n; i++)
+            count[((maxKey - keys[from[i]]) >> shift) & (BUCKETS - 1)]++;
+
+        int start = 0;
+        for (int d = 0; d < BUCKETS; d++) {
+            int size = count[d];
+            count[d] = start;
+            start += size;
+        }
+
+        for (int i = 0; i < n; i++)
+            to[count[((maxKey - keys[from[i]]) >> shift) & (BUCKETS - 1)]++] = from[i];
+
+        int* swapped = from;
+        from = to;
+        to = swapped;
+    }
+
+    if (from != order) memcpy(order, from, n * sizeof(int));
+    delete[] buffer;
+    delete[] count;
+}
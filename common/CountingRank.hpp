@@ -0,0 +1,64 @@
+#ifndef COUNTINGRANK_HPP
+#define COUNTINGRANK_HPP
+
+#include <cstdint>
+#include "TopK.hpp"
+using namespace std;
+
+// ---------- Ranking Mode ----------
+// How every engine orders its matches, chosen once per process with
+// "--ranking auto|sort|counting":
+//   auto      top-K selection when only a few rows are shown, the engine's
+//             own sort otherwise (the default)
+//   sort      always the engine's own insertion or merge sort
+//   counting  always CountingRank on the engine's integer weight
+// Every mode lists the same rows in the same order: each sort, TopK and
+// CountingRank keep equal matches in load order.
+enum RankingMode { RANK_AUTO, RANK_SORT, RANK_COUNTING };
+
+class Ranking {
+private:
+    static RankingMode current;
+
+public:
+    static void configure(RankingMode mode) { current = mode; }
+    static RankingMode mode() { return current; }
+    static const char* name(RankingMode mode);
+    // False when text is not one of the mode names
+    static bool parse(const char* text, RankingMode &mode);
+    // Value of "--ranking MODE" on the command line, RANK_AUTO when absent
+    static RankingMode modeFromArgs(int argc, char* argv[]);
+
+    // Top-K selection only runs in auto mode, and only when it pays off
+    static bool selectTop(int k, int n) { return current == RANK_AUTO && isTopKSmall(k, n); }
+    static bool counting() { return current == RANK_COUNTING; }
+};
+
+// ---------- Counting Rank ----------
+// Stable LSD radix sort on non-negative integer keys, highest key first.
+// Each pass is a counting sort on DIGIT_BITS bits of the key, so the weight
+// sums the engines rank (a few hundred at most) take a single O(n + 2048)
+// pass and wider keys one pass per 11 bits. Equal keys keep their input
+// order, so a tie-break on load order comes for free; other tie-breaks are
+// folded into the low bits of the key.
+class CountingRank {
+public:
+    static const int DIGIT_BITS = 11;
+    static const int BUCKETS = 1 << DIGIT_BITS;
+
+    // Percentage scores below are ratios of positional weight sums, and two
+    // different ones (denominators up to 5050, i.e. 100 skills) differ by
+    // more than 3.9e-6, so this scale keeps them apart and in order
+    static const int64_t PERCENT_SCALE = 1000000;
+    static const int PERCENT_BITS = 27;   // 100 * PERCENT_SCALE < 2^27
+
+    // Writes the positions 0..n-1 to order, best key first
+    static void rank(const uint64_t keys[], int n, int order[]);
+
+    // Fixed-point key for a 0-100 score; equal scores get equal keys
+    static uint64_t percentKey(double percent) {
+        return percent <= 0.0 ? 0 : (uint64_t)(percent * PERCENT_SCALE + 0.5);
+    }
+};
+
+#endif // COUNTINGRANK_HPP
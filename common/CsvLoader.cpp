@@ -0,0 +1,171 @@
+#include "CsvLoader.hpp"
+#include <cstring>
+#include <cctype>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+// ---------- Mapped File ----------
+MappedFile::MappedFile() : data(nullptr), length(0), opened(false) {
+#ifdef _WIN32
+    fileHandle = mappingHandle = nullptr;
+#else
+    fd = -1;
+#endif
+}
+
+MappedFile::MappedFile(const string &filename) : MappedFile() {
+    open(filename);
+}
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+bool MappedFile::open(const string &filename) {
+    close();
+#ifdef _WIN32
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize)) {
+        CloseHandle(file);
+        return false;
+    }
+    fileHandle = file;
+    length = (size_t)fileSize.QuadPart;
+    opened = true;
+    if (length == 0) return true; // empty file: nothing to map
+
+    mappingHandle = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mappingHandle) data = (const char*)MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+    if (!data) {
+        close();
+        return false;
+    }
+#else
+    fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        ::close(fd);
+        fd = -1;
+        return false;
+    }
+    length = (size_t)st.st_size;
+    opened = true;
+    if (length == 0) return true; // empty file: nothing to map
+
+    void* mapped = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapped == MAP_FAILED) {
+        close();
+        return false;
+    }
+    madvise(mapped, length, MADV_SEQUENTIAL);
+    data = (const char*)mapped;
+#endif
+    return true;
+}
+
+void MappedFile::close() {
+#ifdef _WIN32
+    if (data) UnmapViewOfFile(data);
+    if (mappingHandle) CloseHandle(mappingHandle);
+    if (fileHandle) CloseHandle(fileHandle);
+    fileHandle = mappingHandle = nullptr;
+#else
+    if (data) munmap((void*)data, length);
+    if (fd >= 0) ::close(fd);
+    fd = -1;
+#endif
+    data = nullptr;
+    length = 0;
+    opened = false;
+}
+
+// ---------- Trim ----------
+string_view CsvReader::trimView(string_view s) {
+    size_t start = s.find_first_not_of(" \t\r\n\"");
+    if (start == string_view::npos) return string_view();
+    size_t end = s.find_last_not_of(" \t\r\n\"");
+    return s.substr(start, end - start + 1);
+}
+
+string CsvReader::normalizeKey(string_view s) {
+    string key(trimView(s));
+    for (char &c : key) c = (char)tolower((unsigned char)c);
+    return key;
+}
+
+// ---------- Skill Tokenizer ----------
+SkillTokenizer::SkillTokenizer(string_view field) : rest(field), done(field.empty()) {}
+
+bool SkillTokenizer::next(string_view &skill) {
+    while (!done) {
+        size_t comma = rest.find(',');
+        string_view token;
+        if (comma == string_view::npos) {
+            token = rest;
+            done = true;
+        } else {
+            token = rest.substr(0, comma);
+            rest.remove_prefix(comma + 1);
+        }
+        token = CsvReader::trimView(token);
+        if (!token.empty()) {
+            skill = token;
+            return true;
+        }
+    }
+    return false;
+}
+
+// ---------- CSV Reader ----------
+CsvReader::CsvReader(const string &filename) : file(filename), cursor(nullptr), end(nullptr) {
+    cursor = file.begin();
+    end = cursor ? cursor + file.size() : nullptr;
+}
+
+int CsvReader::remainingLines() const {
+    int lines = 0;
+    const char* scan = cursor;
+    while (scan && scan < end) {
+        const char* lineEnd = (const char*)memchr(scan, '\n', end - scan);
+        lines++;
+        scan = lineEnd ? lineEnd + 1 : end;
+    }
+    return lines;
+}
+
+bool CsvReader::next(CsvRow &row) {
+    while (cursor && cursor < end) {
+        const char* lineEnd = (const char*)memchr(cursor, '\n', end - cursor);
+        if (!lineEnd) lineEnd = end;
+        string_view line(cursor, lineEnd - cursor);
+        cursor = (lineEnd < end) ? lineEnd + 1 : end;
+
+        if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+        size_t commaPos = line.find(',');
+        if (commaPos == string_view::npos) continue;
+
+        row.key = trimView(line.substr(0, commaPos));
+
+        string_view skills = line.substr(commaPos + 1);
+        size_t start = skills.find_first_not_of(" \t");
+        skills = (start == string_view::npos) ? string_view() : skills.substr(start);
+        if (!skills.empty() && skills.front() == '"') skills.remove_prefix(1);
+        if (!skills.empty() && skills.back() == '"') skills.remove_suffix(1);
+        row.skills = skills;
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,87 @@
+#ifndef CSVLOADER_HPP
+#define CSVLOADER_HPP
+
+#include <string>
+#include <string_view>
+#include <cstddef>
+using namespace std;
+
+// ---------- Memory-Mapped File ----------
+// Read-only view of a whole file. The mapping lives as long as the object,
+// so every string_view handed out by CsvReader stays valid until then.
+class MappedFile {
+private:
+    const char* data;
+    size_t length;
+    bool opened;
+#ifdef _WIN32
+    void* fileHandle;
+    void* mappingHandle;
+#else
+    int fd;
+#endif
+
+public:
+    MappedFile();
+    explicit MappedFile(const string &filename);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool open(const string &filename);
+    void close();
+
+    bool isOpen() const { return opened; }
+    const char* begin() const { return data; }
+    size_t size() const { return length; }
+};
+
+// ---------- CSV Row ----------
+// One "Name,"skill, skill, ..."" record. Both fields point into the mapping.
+struct CsvRow {
+    string_view key;     // first column, trimmed of spaces and quotes
+    string_view skills;  // rest of the line, outer quotes stripped
+};
+
+// ---------- Skill Tokenizer ----------
+// Splits a skill field on ',' in place; yields trimmed, non-empty tokens.
+class SkillTokenizer {
+private:
+    string_view rest;
+    bool done;
+
+public:
+    explicit SkillTokenizer(string_view field);
+    bool next(string_view &skill);
+};
+
+// ---------- CSV Reader ----------
+// Walks the mapped file line by line without copying. Empty lines and lines
+// without a comma are skipped.
+class CsvReader {
+private:
+    MappedFile file;
+    const char* cursor;
+    const char* end;
+
+public:
+    explicit CsvReader(const string &filename);
+
+    bool isOpen() const { return file.isOpen(); }
+    size_t size() const { return file.size(); }
+    // The whole file, e.g. to fingerprint it
+    const MappedFile& mapping() const { return file; }
+    bool next(CsvRow &row);
+    // Lines left to read: an upper bound on the rows next() will return,
+    // for sizing containers before a load
+    int remainingLines() const;
+
+    static string_view trimView(string_view s);
+    // trimView() lowercased: the form titles and skills are matched on.
+    // Loaders store it next to the display string once, so lookups compare
+    // ready keys instead of lowercasing both sides on every probe.
+    static string normalizeKey(string_view s);
+};
+
+#endif // CSVLOADER_HPP
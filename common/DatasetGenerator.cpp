@@ -0,0 +1,265 @@
+#include "DatasetGenerator.hpp"
+#include <fstream>
+#include <algorithm>
+#include <cmath>
+#include <cctype>
+
+// The vocabulary the data cleaners extract, most popular first under Zipf
+static const char* const BASE_SKILLS[BASE_VOCABULARY_SIZE] = {
+    "SQL", "Python", "Excel", "Git", "Machine Learning", "Power BI", "Java",
+    "Agile", "Docker", "Statistics", "Tableau", "Data Cleaning", "Pandas",
+    "Reporting", "Deep Learning", "TensorFlow", "REST APIs", "Scrum", "Cloud",
+    "Spring Boot", "NLP", "System Design", "PyTorch", "User Stories", "Keras",
+    "Computer Vision", "MLOps", "Product Roadmap", "Stakeholder Management"
+};
+
+// Two words each, as data_cleaning_job_description reads the title; sorted
+// so the generated mergejob.csv keeps its titles in order
+const int ROLE_COUNT = 5;
+static const char* const ROLES[ROLE_COUNT] = {
+    "Data Analyst", "Data Scientist", "ML Engineer", "Product Manager", "Software Engineer"
+};
+
+// Filler for the raw text; none of them is a skill
+const int FILLER_COUNT = 24;
+static const char* const FILLER[FILLER_COUNT] = {
+    "well", "try", "our", "again", "wait", "hair", "agent", "system", "cold", "staff",
+    "truth", "store", "better", "drop", "give", "quickly", "senior", "scene", "prepare",
+    "soon", "general", "word", "worry", "week"
+};
+
+static string padded(long long value, long long largest) {
+    string digits = to_string(value);
+    size_t width = to_string(largest).size();
+    return string(width - digits.size(), '0') + digits;
+}
+
+// ---------- Constructor ----------
+DatasetGenerator::DatasetGenerator(const GeneratorOptions &opts) : options(opts), cumulative(nullptr), state(0) {
+    if (options.vocabularySize < 1) options.vocabularySize = 1;
+    if (options.vocabularySize > MAX_VOCABULARY_SIZE) options.vocabularySize = MAX_VOCABULARY_SIZE;
+    if (options.minSkills < 1) options.minSkills = 1;
+    if (options.maxSkills > MAX_GENERATED_SKILLS) options.maxSkills = MAX_GENERATED_SKILLS;
+    if (options.maxSkills > options.vocabularySize) options.maxSkills = options.vocabularySize;
+    if (options.minSkills > options.maxSkills) options.minSkills = options.maxSkills;
+
+    int n = options.vocabularySize;
+    vocabulary = new string[n];
+    for (int i = 0; i < n; i++) {
+        if (i < BASE_VOCABULARY_SIZE) {
+            vocabulary[i] = BASE_SKILLS[i];
+        } else {
+            vocabulary[i] = "Skill " + padded(i + 1, MAX_VOCABULARY_SIZE);
+        }
+    }
+
+    // Alphabetical rank of every skill, so each record lists its skills
+    // sorted the way the cleaners write them
+    int* order = new int[n];
+    for (int i = 0; i < n; i++) order[i] = i;
+    sort(order, order + n, [&](int a, int b) { return vocabulary[a] < vocabulary[b]; });
+    nameRank = new int[n];
+    for (int i = 0; i < n; i++) nameRank[order[i]] = i;
+    delete[] order;
+
+    if (options.distribution == SKILLS_ZIPF) {
+        cumulative = new double[n];
+        double total = 0.0;
+        for (int k = 0; k < n; k++) {
+            total += 1.0 / pow(k + 1, options.zipfExponent);
+            cumulative[k] = total;
+        }
+        for (int k = 0; k < n; k++) cumulative[k] /= total;
+    }
+}
+
+DatasetGenerator::~DatasetGenerator() {
+    delete[] vocabulary;
+    delete[] nameRank;
+    delete[] cumulative;
+}
+
+// ---------- Random Numbers ----------
+// splitmix64: the same sequence on every platform and standard library
+void DatasetGenerator::restart() {
+    state = options.seed;
+}
+
+uint64_t DatasetGenerator::nextRandom() {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+int DatasetGenerator::below(int n) {
+    return (int)(nextRandom() % (uint64_t)n);
+}
+
+double DatasetGenerator::unit() {
+    return (nextRandom() >> 11) * (1.0 / 9007199254740992.0);   // [0, 1)
+}
+
+// ---------- Skill Selection ----------
+int DatasetGenerator::pickSkill() {
+    if (!cumulative) return below(options.vocabularySize);
+
+    // First rank whose cumulative probability reaches u
+    double u = unit();
+    int left = 0, right = options.vocabularySize - 1;
+    while (left < right) {
+        int mid = left + (right - left) / 2;
+        if (cumulative[mid] < u) left = mid + 1;
+        else right = mid;
+    }
+    return left;
+}
+
+static bool isChosen(const int chosen[], int count, int skill) {
+    for (int i = 0; i < count; i++)
+        if (chosen[i] == skill) return true;
+    return false;
+}
+
+int DatasetGenerator::pickSkills(int chosen[]) {
+    int count = options.minSkills + below(options.maxSkills - options.minSkills + 1);
+    int kept = 0;
+
+    // Redraw repeats. A steep Zipf makes the last rare skills slow to hit,
+    // so after enough redraws walk on to the next unused skill instead.
+    int attempts = 0;
+    while (kept < count) {
+        int skill = pickSkill();
+        if (++attempts > 32 * count) {
+            while (isChosen(chosen, kept, skill)) skill = (skill + 1) % options.vocabularySize;
+        }
+        if (!isChosen(chosen, kept, skill)) chosen[kept++] = skill;
+    }
+
+    for (int i = 1; i < kept; i++) {
+        int key = chosen[i];
+        int j = i - 1;
+        while (j >= 0 && nameRank[chosen[j]] > nameRank[key]) {
+            chosen[j + 1] = chosen[j];
+            j--;
+        }
+        chosen[j + 1] = key;
+    }
+    return kept;
+}
+
+// ---------- Line Builders ----------
+// withNoise mixes filler words into the list, as in the raw resumes
+void DatasetGenerator::appendSkills(string &line, const int chosen[], int count, bool withNoise) {
+    for (int i = 0; i < count; i++) {
+        if (i > 0) line += ", ";
+        line += vocabulary[chosen[i]];
+        if (withNoise && below(4) == 0) {
+            line += ", ";
+            line += FILLER[below(FILLER_COUNT)];
+        }
+    }
+}
+
+void DatasetGenerator::appendSentence(string &line) {
+    int words = 4 + below(5);
+    for (int w = 0; w < words; w++) {
+        string word = FILLER[below(FILLER_COUNT)];
+        if (w == 0) word[0] = toupper(word[0]);
+        else line += ' ';
+        line += word;
+    }
+    line += '.';
+}
+
+// ---------- Writers ----------
+// Each row is built in one reused string and written straight out
+bool DatasetGenerator::writeCandidates(const string &filename) {
+    ofstream out(filename, ios::binary);
+    if (!out) return false;
+    restart();
+
+    int chosen[MAX_GENERATED_SKILLS];
+    string line;
+    for (long long i = 1; i <= options.rows; i++) {
+        int count = pickSkills(chosen);
+        line = "Candidate " + padded(i, options.rows) + ",\"";
+        appendSkills(line, chosen, count, false);
+        line += "\"\n";
+        out.write(line.data(), line.size());
+    }
+    return (bool)out;
+}
+
+bool DatasetGenerator::writeJobs(const string &filename) {
+    ofstream out(filename, ios::binary);
+    if (!out) return false;
+    restart();
+
+    int chosen[MAX_GENERATED_SKILLS];
+    string line;
+    for (long long i = 1; i <= options.rows; i++) {
+        int count = pickSkills(chosen);
+        int role = (int)((i - 1) * ROLE_COUNT / options.rows);
+        line = string(ROLES[role]) + " " + padded(i, options.rows) + ",\"";
+        appendSkills(line, chosen, count, false);
+        line += "\"\n";
+        out.write(line.data(), line.size());
+    }
+    return (bool)out;
+}
+
+bool DatasetGenerator::writeResumes(const string &filename) {
+    ofstream out(filename, ios::binary);
+    if (!out) return false;
+    restart();
+
+    int chosen[MAX_GENERATED_SKILLS];
+    string line;
+    out << "resume\n";
+    for (long long i = 0; i < options.rows; i++) {
+        int count = pickSkills(chosen);
+        line = "\"Experienced professional skilled in ";
+        appendSkills(line, chosen, count, true);
+        line += ". ";
+        appendSentence(line);
+        line += ' ';
+        appendSentence(line);
+        line += "\"\n";
+        out.write(line.data(), line.size());
+    }
+    return (bool)out;
+}
+
+bool DatasetGenerator::writeJobDescriptions(const string &filename) {
+    ofstream out(filename, ios::binary);
+    if (!out) return false;
+    restart();
+
+    int chosen[MAX_GENERATED_SKILLS];
+    string line;
+    out << "job_description\n";
+    for (long long i = 0; i < options.rows; i++) {
+        int count = pickSkills(chosen);
+        line = "\"" + string(ROLES[below(ROLE_COUNT)]) + " needed with experience in ";
+        appendSkills(line, chosen, count, false);
+        line += ". ";
+        appendSentence(line);
+        line += "\"\n";
+        out.write(line.data(), line.size());
+    }
+    return (bool)out;
+}
+
+// ---------- Counts ----------
+long long DatasetGenerator::parseCount(const string &text) {
+    if (text.empty()) return 0;
+    long long scale = 1;
+    string digits = text;
+    char suffix = toupper(text.back());
+    if (suffix == 'K') scale = 1000;
+    else if (suffix == 'M') scale = 1000000;
+    if (scale > 1) digits.pop_back();
+    if (digits.empty() || digits.size() > 12 || digits.find_first_not_of("0123456789") != string::npos) return 0;
+    return stoll(digits) * scale;
+}
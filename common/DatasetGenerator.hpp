@@ -0,0 +1,77 @@
+#ifndef DATASETGENERATOR_HPP
+#define DATASETGENERATOR_HPP
+
+#include <string>
+#include <cstdint>
+using namespace std;
+
+// ---------- Generator Options ----------
+// Which skills a record draws: every vocabulary skill equally often, or the
+// k-th skill with probability proportional to 1 / k^zipfExponent, so a few
+// skills are common and most are rare, as in real resumes.
+enum SkillDistribution {
+    SKILLS_UNIFORM,
+    SKILLS_ZIPF
+};
+
+const int BASE_VOCABULARY_SIZE = 29;     // skills the data cleaners know
+const int MAX_GENERATED_SKILLS = 20;     // per record, the array engines' limit
+const int MAX_VOCABULARY_SIZE = 60000;   // stays below INVALID_SKILL
+
+struct GeneratorOptions {
+    long long rows = 1000;
+    int vocabularySize = BASE_VOCABULARY_SIZE;
+    int minSkills = 2;                   // skills per record, drawn uniformly
+    int maxSkills = 6;
+    SkillDistribution distribution = SKILLS_ZIPF;
+    double zipfExponent = 1.0;
+    uint64_t seed = 42;
+};
+
+// ---------- Dataset Generator ----------
+// Writes synthetic datasets one row at a time, so memory use depends on the
+// vocabulary, not on the row count. The first BASE_VOCABULARY_SIZE skills
+// are the real ones; larger vocabularies add "Skill NNNNN" names, which the
+// data cleaners do not recognise. Every write starts again from the seed,
+// so the same options always produce the same file.
+//
+//   writeCandidates       candidates.csv  "Candidate N,"skill, skill""
+//   writeJobs             mergejob.csv    "<Role> N,"skill, skill"", titles sorted
+//   writeResumes          resume.csv      raw text for data_cleaning_resume
+//   writeJobDescriptions  job_description.csv, raw text for data_cleaning_job_description
+class DatasetGenerator {
+private:
+    GeneratorOptions options;
+    string* vocabulary;
+    int* nameRank;        // position of each skill in alphabetical order
+    double* cumulative;   // Zipf CDF over the vocabulary, nullptr when uniform
+    uint64_t state;
+
+    void restart();
+    uint64_t nextRandom();
+    int below(int n);
+    double unit();
+    int pickSkill();
+    // Distinct skills for one record, in alphabetical order; returns how many
+    int pickSkills(int chosen[]);
+    void appendSkills(string &line, const int chosen[], int count, bool withNoise);
+    void appendSentence(string &line);
+
+public:
+    explicit DatasetGenerator(const GeneratorOptions &options);
+    ~DatasetGenerator();
+
+    DatasetGenerator(const DatasetGenerator&) = delete;
+    DatasetGenerator& operator=(const DatasetGenerator&) = delete;
+
+    // False when the file cannot be written
+    bool writeCandidates(const string &filename);
+    bool writeJobs(const string &filename);
+    bool writeResumes(const string &filename);
+    bool writeJobDescriptions(const string &filename);
+
+    // "1000", "10K", "100M"; 0 when malformed
+    static long long parseCount(const string &text);
+};
+
+#endif // DATASETGENERATOR_HPP
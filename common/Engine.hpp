@@ -0,0 +1,87 @@
+#ifndef ENGINE_HPP
+#define ENGINE_HPP
+
+#include <string>
+#include "AllocStats.hpp"
+#include "SkillDictionary.hpp"
+using namespace std;
+
+// ---------- Datasets ----------
+const char* const DEFAULT_JOBS_FILE = "job_description/mergejob.csv";
+const char* const DEFAULT_CANDIDATES_FILE = "resume/candidates.csv";
+
+// ---------- Engine Query ----------
+// One search with no prompts and no output, as the benchmark runs it. HR
+// engines look up jobTitle and rank candidates on the skills and their 1-10
+// weights; job seeker engines rank jobs on the skills alone and ignore the
+// title and weights.
+struct EngineQuery {
+    string jobTitle;
+    const string* skills;
+    const int* weights;
+    int skillCount;
+};
+
+// Looks the query's skills up in the global dictionary and copies their IDs
+// and weights out; unknown and repeated skills are dropped. Returns how many
+// were kept, at most max.
+inline int resolveQuerySkills(const EngineQuery &query, SkillId ids[], int weights[], int max) {
+    int count = 0;
+    for (int i = 0; i < query.skillCount && count < max; i++) {
+        SkillId id = SkillDictionary::global().find(query.skills[i]);
+        if (id == INVALID_SKILL) continue;
+        bool repeated = false;
+        for (int k = 0; k < count; k++) repeated = repeated || ids[k] == id;
+        if (repeated) continue;
+        ids[count] = id;
+        weights[count] = query.weights ? query.weights[i] : 0;
+        count++;
+    }
+    return count;
+}
+
+// ---------- Engine ----------
+// One matching engine as the launcher sees it. load() reads the engine's
+// datasets once and keeps them in memory; query() runs one interactive
+// session (searches and the engine's performance report) against them and
+// can be called again without reloading.
+//
+// Each engine defines createEngine() in its own namespace. Its standalone
+// main() is compiled out with -DENGINE_NO_MAIN when it is linked into the
+// launcher.
+class Engine {
+public:
+    virtual ~Engine() {}
+
+    virtual const char* name() const = 0;
+    // Prints its own error and returns false when a dataset is missing.
+    // Job seeker engines only read jobsFile.
+    virtual bool loadFrom(const string &jobsFile, const string &candidatesFile) = 0;
+    bool load() { return loadFrom(DEFAULT_JOBS_FILE, DEFAULT_CANDIDATES_FILE); }
+    virtual void query() = 0;
+
+    // Records one query scans: candidates for HR engines, jobs for job
+    // seekers. Smaller than the file when the engine has a fixed capacity.
+    virtual int recordCount() const = 0;
+    // Search and ranking exactly as query() runs them, without the menus or
+    // the result table. False when the job title is unknown.
+    virtual bool runQuery(const EngineQuery &query) = 0;
+};
+
+// Standalone main(): load once, run one session
+inline int runEngine(Engine* engine) {
+    int status = 1;
+    bool loaded;
+    {
+        AllocScope loading(ALLOC_LOAD);
+        loaded = engine->load();
+    }
+    if (loaded) {
+        engine->query();
+        status = 0;
+    }
+    delete engine;
+    return status;
+}
+
+#endif // ENGINE_HPP
@@ -0,0 +1,41 @@
+#ifndef ENGINECATALOG_HPP
+#define ENGINECATALOG_HPP
+
+#include "Engine.hpp"
+
+// Each engine's factory, defined in its own namespace. Only programs that
+// link all eight engines (the launcher, the benchmark) include this header.
+namespace insertion_binary_hr { Engine* createEngine(); }
+namespace merge_jump_hr { Engine* createEngine(); }
+namespace linear_insertion_hr { Engine* createEngine(); }
+namespace optimized_merge_hr { Engine* createEngine(); }
+namespace insertion_binary_jobseeker { Engine* createEngine(); }
+namespace merge_jump_jobseeker { Engine* createEngine(); }
+namespace linear_insertion_jobseeker { Engine* createEngine(); }
+namespace optimized_merge_jobseeker { Engine* createEngine(); }
+
+// ---------- Engine Catalog ----------
+// Indexed by role (HR 0-3, job seeker 4-7), then structure (array, linked
+// list), then algorithm pair. key names the engine on command lines and in
+// reports.
+typedef Engine* (*EngineFactory)();
+
+struct EngineEntry {
+    const char* key;
+    bool hr;               // ranks candidates (true) or jobs (false)
+    EngineFactory create;
+};
+
+const int ENGINE_COUNT = 8;
+const EngineEntry ENGINE_CATALOG[ENGINE_COUNT] = {
+    { "hr-insertion-binary", true,  insertion_binary_hr::createEngine },
+    { "hr-merge-jump",       true,  merge_jump_hr::createEngine },
+    { "hr-linear-insertion", true,  linear_insertion_hr::createEngine },
+    { "hr-optimized-merge",  true,  optimized_merge_hr::createEngine },
+    { "js-insertion-binary", false, insertion_binary_jobseeker::createEngine },
+    { "js-merge-jump",       false, merge_jump_jobseeker::createEngine },
+    { "js-linear-insertion", false, linear_insertion_jobseeker::createEngine },
+    { "js-optimized-merge",  false, optimized_merge_jobseeker::createEngine },
+};
+
+#endif // ENGINECATALOG_HPP
@@ -0,0 +1,114 @@
+#include "MatchCache.hpp"
+#include "ScoringKernel.hpp"
+
+// ---------- Constructor / Destructor ----------
+MatchCache::MatchCache()
+    : selectedCount(0), selectedMask(0), byId(false), armed(false), filled(false),
+      candidates(nullptr), hits(nullptr), count(0), capacity(0),
+      scoredSkills(nullptr), scoredWeight(nullptr) {}
+
+MatchCache::~MatchCache() {
+    delete[] candidates;
+    delete[] hits;
+    delete[] scoredSkills;
+    delete[] scoredWeight;
+}
+
+void MatchCache::clear() {
+    selectedCount = 0;
+    selectedMask = 0;
+    armed = false;
+    filled = false;
+    count = 0;
+}
+
+// Same skills as the noted selection, in any order
+bool MatchCache::isSelection(const SkillId ids[], int n) const {
+    if (n != selectedCount) return false;
+    for (int i = 0; i < n; i++) {
+        bool found = false;
+        for (int k = 0; k < selectedCount && !found; k++)
+            found = selected[k] == ids[i];
+        if (!found) return false;
+    }
+    return true;
+}
+
+// ---------- Recording ----------
+bool MatchCache::begin(const SkillId ids[], const int weights[], int n) {
+    bool repeated = isSelection(ids, n);
+    clear();
+    if (n <= 0 || n > MASK_SKILLS) return false;
+    for (int i = 0; i < n; i++) {
+        if (ids[i] == INVALID_SKILL || weights[i] < 1) return false;
+        for (int k = 0; k < i; k++)
+            if (ids[k] == ids[i]) return false;
+    }
+
+    byId = SkillBitset::vocabularyFits();
+    for (int i = 0; i < n; i++) {
+        selected[i] = ids[i];
+        if (byId) SkillBitset::addSkill(selectedMask, ids[i]);
+    }
+    selectedCount = n;
+    armed = byId || repeated;
+    return armed;
+}
+
+SkillMask MatchCache::slotOf(SkillId id) const {
+    if (byId) return SkillBitset::fits(id) ? selectedMask & ((SkillMask)1 << id) : 0;
+    for (int i = 0; i < selectedCount; i++)
+        if (selected[i] == id) return (SkillMask)1 << i;
+    return 0;
+}
+
+void MatchCache::grow(int atLeast) {
+    int newCapacity = capacity == 0 ? 1024 : capacity * 2;
+    if (newCapacity < atLeast) newCapacity = atLeast;
+    int* newCandidates = new int[newCapacity];
+    SkillMask* newHits = new SkillMask[newCapacity];
+    for (int i = 0; i < count; i++) {
+        newCandidates[i] = candidates[i];
+        newHits[i] = hits[i];
+    }
+    delete[] candidates;
+    delete[] hits;
+    delete[] scoredSkills;
+    delete[] scoredWeight;
+    candidates = newCandidates;
+    hits = newHits;
+    scoredSkills = new int[newCapacity];
+    scoredWeight = new int[newCapacity];
+    capacity = newCapacity;
+}
+
+// ---------- Rescoring ----------
+// The new weights are laid on the cached slots, so the hit masks score
+// against them exactly like skill masks against a fresh query
+bool MatchCache::rescore(const SkillId ids[], const int weights[], int n, const SkillMask skillMasks[]) {
+    if (!filled || n != selectedCount) return false;
+    for (int i = 0; i < n; i++)
+        if (weights[i] < 1) return false;
+
+    SkillId slots[MASK_SKILLS];
+    SkillMask seen = 0;
+    for (int i = 0; i < n; i++) {
+        SkillMask bit = slotOf(ids[i]);
+        if (bit == 0 || (seen & bit)) return false;
+        seen |= bit;
+
+        SkillId slot = 0;
+        while (!(bit & 1)) {
+            bit >>= 1;
+            slot++;
+        }
+        slots[i] = slot;
+    }
+
+    WeightedQuery query;
+    if (!SkillBitset::buildQuery(slots, weights, n, query)) return false;
+    if (byId)
+        for (int k = 0; k < count; k++) hits[k] = skillMasks[candidates[k]] & selectedMask;
+    if (count > 0) ScoringKernel::score(hits, count, query, scoredSkills, scoredWeight);
+    return true;
+}
@@ -0,0 +1,106 @@
+#ifndef MATCHCACHE_HPP
+#define MATCHCACHE_HPP
+
+#include "SkillDictionary.hpp"
+#include "SkillBitset.hpp"
+
+// ---------- Match Cache ----------
+// The candidates an HR engine's last search matched. Tuning the 1-10 weights
+// of the same skills cannot change who matches or which skills they match,
+// so when the next search selects the same skills (in any order) rescore()
+// rebuilds every matched count and weighted sum with ScoringKernel, and the
+// engine re-ranks without searching again.
+//
+// While every interned skill has a SkillMask bit, the cache keeps only the
+// candidates' ordinals: each search add()s the matches it lists anyway, and
+// rescore() derives the hit masks from the candidates' skill masks ANDed
+// with the selection. Every search records, so the first weight change of a
+// tuning session is already rescored.
+//
+// Otherwise skill i of the selection gets bit i, and the engine has to OR in
+// slotOf() for each skill a candidate holds to build its hit mask. That costs
+// a pass over the matches, so in this mode a search only records when it
+// repeats the previous search's skills: a stream of unrelated queries pays
+// nothing, the first weight change searches and records, and every later one
+// is rescored.
+//
+// Each search calls begin() with its selection, and when that returns true
+// add()s every candidate holding at least one selected skill, in the order
+// the engine lists its matches; usesSkillMasks() says which add() to call.
+class MatchCache {
+private:
+    SkillId selected[MASK_SKILLS];
+    int selectedCount;
+    SkillMask selectedMask;   // bits of the selected skills, by-ID slots only
+    bool byId;                // slots are SkillIds rather than positions
+    bool armed;               // this search records
+    bool filled;              // holds a completed recording
+
+    int* candidates;          // engine ordinals, in recording order
+    SkillMask* hits;          // recorded by position slots; by ID, built in rescore()
+    int count;
+    int capacity;
+
+    // rescore() output, one entry per cached candidate
+    int* scoredSkills;
+    int* scoredWeight;
+
+    void grow(int atLeast);
+    bool isSelection(const SkillId ids[], int n) const;
+
+public:
+    MatchCache();
+    ~MatchCache();
+
+    MatchCache(const MatchCache&) = delete;
+    MatchCache& operator=(const MatchCache&) = delete;
+
+    // Notes a search over ids and forgets the previous recording. True when
+    // the search should record: none of ids repeats, there are at most
+    // MASK_SKILLS of them, every weight is at least 1 (the search skips who
+    // holds a zero-weight skill), and with position slots ids are also the
+    // previous search's skills. Otherwise add() is ignored.
+    bool begin(const SkillId ids[], const int weights[], int n);
+    bool recording() const { return armed && !filled; }
+    // ids are the noted selection as a set
+    bool repeats(const SkillId ids[], int n) const { return isSelection(ids, n); }
+    // Ends the recording; rescore() can match it from now on
+    void finish() { filled = armed; }
+    // Drops the cached search, e.g. when the candidates are reloaded
+    void clear();
+
+    // By-ID slots: add(candidate) records the ordinal alone. Position slots:
+    // add(candidate, hitMask) with the slotOf() bits of the skills it holds.
+    bool usesSkillMasks() const { return byId; }
+    // Bit of one skill, 0 when it is not selected
+    SkillMask slotOf(SkillId id) const;
+    // Room for n entries, when the engine knows how many it will add
+    void reserve(int n) {
+        if (n > capacity) grow(n);
+    }
+    void add(int candidate) {
+        if (!recording()) return;
+        if (count == capacity) grow(count + 1);
+        candidates[count++] = candidate;
+    }
+    void add(int candidate, SkillMask hitMask) {
+        if (!recording()) return;
+        if (count == capacity) grow(count + 1);
+        candidates[count] = candidate;
+        hits[count] = hitMask;
+        count++;
+    }
+
+    // True when ids is the cached selection as a set; every cached entry is
+    // then rescored with the new weights. skillMasks are the engine's
+    // candidate masks by ordinal, read with by-ID slots only. False leaves
+    // the cache untouched.
+    bool rescore(const SkillId ids[], const int weights[], int n, const SkillMask skillMasks[]);
+
+    int size() const { return count; }
+    int candidate(int i) const { return candidates[i]; }
+    int matchedSkills(int i) const { return scoredSkills[i]; }
+    int matchedWeight(int i) const { return scoredWeight[i]; }
+};
+
+#endif // MATCHCACHE_HPP
@@ -0,0 +1,88 @@
+#include "MemoryStats.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#pragma comment(lib, "psapi.lib")
+#else
+#include <sys/resource.h>
+#include <malloc.h>
+#endif
+
+#ifndef _WIN32
+// Value of a "Key:   1234 kB" line in /proc/self/status, 0 if absent
+static size_t procStatusKB(const char* key) {
+    FILE* file = fopen("/proc/self/status", "r");
+    if (!file) return 0;
+    char line[256];
+    size_t keyLength = strlen(key);
+    size_t value = 0;
+    while (fgets(line, sizeof(line), file)) {
+        if (strncmp(line, key, keyLength) == 0 && line[keyLength] == ':') {
+            value = (size_t)strtoull(line + keyLength + 1, nullptr, 10);
+            break;
+        }
+    }
+    fclose(file);
+    return value;
+}
+#endif
+
+// ---------- Process Memory ----------
+size_t MemoryStats::currentRssKB() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS pmc;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc))) return 0;
+    return pmc.WorkingSetSize / 1024;
+#else
+    return procStatusKB("VmRSS");
+#endif
+}
+
+size_t MemoryStats::peakRssKB() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS pmc;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc))) return 0;
+    return pmc.PeakWorkingSetSize / 1024;
+#else
+    size_t peak = procStatusKB("VmHWM");
+    if (peak == 0) {
+        struct rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) == 0) peak = (size_t)usage.ru_maxrss;   // KB on Linux
+    }
+    return peak;
+#endif
+}
+
+size_t MemoryStats::heapInUseBytes() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS_EX pmc;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), (PROCESS_MEMORY_COUNTERS*)&pmc, sizeof(pmc))) return 0;
+    return pmc.PrivateUsage;
+#elif defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    struct mallinfo2 info = mallinfo2();
+    return info.uordblks + info.hblkhd;   // small blocks in use + mmap'd blocks
+#elif defined(__GLIBC__)
+    struct mallinfo info = mallinfo();
+    return (size_t)(unsigned)info.uordblks + (size_t)(unsigned)info.hblkhd;
+#else
+    return 0;
+#endif
+}
+
+// ---------- Memory Phase ----------
+void MemoryPhase::start() {
+    previousPhase = AllocStats::enter(phase);
+    heapStart = MemoryStats::heapInUseBytes();
+    rssStart = MemoryStats::currentRssKB();
+    heapDelta = rssDelta = 0;
+}
+
+void MemoryPhase::stop() {
+    heapDelta = (long long)MemoryStats::heapInUseBytes() - (long long)heapStart;
+    rssDelta = (long long)MemoryStats::currentRssKB() - (long long)rssStart;
+    AllocStats::leave(previousPhase);
+}
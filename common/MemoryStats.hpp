@@ -0,0 +1,47 @@
+#ifndef MEMORYSTATS_HPP
+#define MEMORYSTATS_HPP
+
+#include <cstddef>
+#include "AllocStats.hpp"
+using namespace std;
+
+// ---------- Memory Stats ----------
+// Measured process memory for the performance summaries. Linux reads
+// /proc/self/status (falling back to getrusage() for the peak); Windows asks
+// GetProcessMemoryInfo(). Heap in use comes from the allocator: glibc's
+// mallinfo2()/mallinfo() on Linux, private bytes on Windows, 0 elsewhere.
+class MemoryStats {
+public:
+    static size_t currentRssKB();
+    static size_t peakRssKB();
+    static size_t heapInUseBytes();
+};
+
+// ---------- Memory Phase ----------
+// Brackets one phase of a search (matching, sorting): how much the heap and
+// the resident set grew between start() and stop(). Negative when the phase
+// released more than it kept; 0 when it freed everything it allocated.
+// While running it is also the current AllocPhase, so a -DTRACK_ALLOCATIONS
+// build charges the phase's heap traffic to it.
+class MemoryPhase {
+private:
+    AllocPhase phase;
+    AllocPhase previousPhase;
+    size_t heapStart;
+    size_t rssStart;
+    long long heapDelta;
+    long long rssDelta;
+
+public:
+    explicit MemoryPhase(AllocPhase phase = ALLOC_OTHER)
+        : phase(phase), previousPhase(ALLOC_OTHER), heapStart(0), rssStart(0), heapDelta(0), rssDelta(0) {}
+
+    void start();
+    void stop();
+
+    long long heapDeltaBytes() const { return heapDelta; }
+    double heapDeltaKB() const { return heapDelta / 1024.0; }
+    long long rssDeltaKB() const { return rssDelta; }
+};
+
+#endif // MEMORYSTATS_HPP
@@ -0,0 +1,44 @@
+#include "NodeArena.hpp"
+#include <cstdint>
+
+// ---------- Allocation ----------
+void* NodeArena::allocate(size_t bytes, size_t align) {
+    if (blocks) {
+        uintptr_t base = (uintptr_t)(blocks + 1);
+        uintptr_t start = (base + blocks->used + align - 1) & ~(uintptr_t)(align - 1);
+        if (start + bytes <= base + blocks->size) {
+            blocks->used = start + bytes - base;
+            totalBytes += bytes;
+            return (void*)start;
+        }
+    }
+
+    // New block, doubling up to MAX_BLOCK so big loads need few of them;
+    // an oversized request gets a block sized to fit
+    size_t payload = nextBlockSize;
+    if (payload < bytes + align) payload = bytes + align;
+    if (nextBlockSize < MAX_BLOCK) nextBlockSize *= 2;
+
+    // operator new, so -DTRACK_ALLOCATIONS still counts the blocks
+    Block* block = (Block*)::operator new(sizeof(Block) + payload);
+    block->next = blocks;
+    block->size = payload;
+    block->used = 0;
+    blocks = block;
+    return allocate(bytes, align);
+}
+
+// ---------- Release ----------
+void NodeArena::release() {
+    for (Cleanup* cleanup = cleanups; cleanup; cleanup = cleanup->next)
+        cleanup->destroy(cleanup->object);
+    cleanups = nullptr;
+
+    while (blocks) {
+        Block* next = blocks->next;
+        ::operator delete(blocks);
+        blocks = next;
+    }
+    nextBlockSize = FIRST_BLOCK;
+    totalBytes = 0;
+}
@@ -0,0 +1,72 @@
+#ifndef NODEARENA_HPP
+#define NODEARENA_HPP
+
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <type_traits>
+using namespace std;
+
+// ---------- Node Arena ----------
+// Bump allocator for linked-list nodes. Nodes are carved back to back out
+// of large blocks in the order they are created, so a list built during a
+// load sits contiguously in memory and is walked with sequential reads, and
+// every node is released in one shot when the arena is destroyed or
+// release() is called. Nodes cannot be freed one at a time.
+//
+// Destructors still run: a node type that owns memory (a std::string name)
+// gets a small cleanup record, and release() destroys such nodes in reverse
+// order of creation before the blocks are freed.
+class NodeArena {
+private:
+    struct Block {
+        Block* next;
+        size_t size;   // payload bytes after the header
+        size_t used;
+    };
+
+    struct Cleanup {
+        void (*destroy)(void*);
+        void* object;
+        Cleanup* next;
+    };
+
+    Block* blocks;        // newest first
+    Cleanup* cleanups;    // newest first
+    size_t nextBlockSize;
+    size_t totalBytes;
+
+    static const size_t FIRST_BLOCK = 64 * 1024;
+    static const size_t MAX_BLOCK = 16 * 1024 * 1024;
+
+    template<typename T>
+    static void destroyObject(void* object) { static_cast<T*>(object)->~T(); }
+
+public:
+    NodeArena() : blocks(nullptr), cleanups(nullptr), nextBlockSize(FIRST_BLOCK), totalBytes(0) {}
+    ~NodeArena() { release(); }
+
+    NodeArena(const NodeArena&) = delete;
+    NodeArena& operator=(const NodeArena&) = delete;
+
+    // Raw, aligned storage that lives until release()
+    void* allocate(size_t bytes, size_t align);
+
+    // Builds a node in the arena: create<SkillNode>(id, nullptr)
+    template<typename T, typename... Args>
+    T* create(Args&&... args) {
+        T* object = new (allocate(sizeof(T), alignof(T))) T{ forward<Args>(args)... };
+        if (!is_trivially_destructible<T>::value) {
+            Cleanup* cleanup = new (allocate(sizeof(Cleanup), alignof(Cleanup))) Cleanup{ &destroyObject<T>, object, cleanups };
+            cleanups = cleanup;
+        }
+        return object;
+    }
+
+    // Destroys every node and frees every block
+    void release();
+
+    size_t bytesUsed() const { return totalBytes; }
+};
+
+#endif // NODEARENA_HPP
@@ -0,0 +1,152 @@
+#include "QueryCache.hpp"
+#include <cstring>
+#include <cstdlib>
+
+int QueryCache::configuredCapacity = QueryCache::DEFAULT_CAPACITY;
+
+// ---------- Cached Result ----------
+CachedResult::CachedResult()
+    : rowCount(0), matchedCount(0), searchTimeMS(0.0), sortTimeMS(0.0),
+      searchMemoryBytes(0), sortMemoryBytes(0) {}
+
+void CachedResult::addRow(const string &name, int matchedSkills, int matchedWeight, double score) {
+    if (rowCount == CACHED_ROWS) return;
+    CachedRow &row = rows[rowCount++];
+    row.name = name;
+    row.matchedSkills = matchedSkills;
+    row.matchedWeight = matchedWeight;
+    row.score = score;
+}
+
+// ---------- Constructor / Destructor ----------
+QueryCache::QueryCache()
+    : entries(nullptr), count(0), capacity(0), buckets(nullptr), bucketCount(0),
+      newest(-1), oldest(-1), version(0), hitCount(0), missCount(0) {}
+
+QueryCache::~QueryCache() {
+    delete[] entries;
+    delete[] buckets;
+}
+
+int QueryCache::capacityFromArgs(int argc, char* argv[]) {
+    for (int i = 1; i + 1 < argc; i++) {
+        if (strcmp(argv[i], "--query-cache") == 0) return atoi(argv[i + 1]);
+    }
+    return DEFAULT_CAPACITY;
+}
+
+// ---------- Keys ----------
+// Each pair is packed as skill ID then weight, eight bytes, and the pairs are
+// insertion sorted: selections are a handful of skills
+string QueryCache::keyOf(const string &job, const SkillId ids[], const int weights[], int n) {
+    uint64_t* pairs = new uint64_t[n > 0 ? n : 1];
+    for (int i = 0; i < n; i++) {
+        uint64_t pair = ((uint64_t)ids[i] << 32) | (uint32_t)weights[i];
+        int j = i;
+        while (j > 0 && pairs[j - 1] > pair) {
+            pairs[j] = pairs[j - 1];
+            j--;
+        }
+        pairs[j] = pair;
+    }
+
+    string key = job;
+    key.push_back('\0');
+    key.append((const char*)pairs, n * sizeof(uint64_t));
+    delete[] pairs;
+    return key;
+}
+
+// FNV-1a
+uint64_t QueryCache::hashOf(const string &key) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < key.size(); i++) {
+        hash ^= (unsigned char)key[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+int QueryCache::locate(const string &key, uint64_t hash) const {
+    for (int e = buckets[hash & (bucketCount - 1)]; e != -1; e = entries[e].chain)
+        if (entries[e].hash == hash && entries[e].key == key) return e;
+    return -1;
+}
+
+// ---------- LRU List ----------
+void QueryCache::unlink(int e) {
+    Entry &entry = entries[e];
+    if (entry.newer != -1) entries[entry.newer].older = entry.older;
+    else newest = entry.older;
+    if (entry.older != -1) entries[entry.older].newer = entry.newer;
+    else oldest = entry.newer;
+}
+
+void QueryCache::pushNewest(int e) {
+    entries[e].newer = -1;
+    entries[e].older = newest;
+    if (newest != -1) entries[newest].newer = e;
+    newest = e;
+    if (oldest == -1) oldest = e;
+}
+
+void QueryCache::unchain(int e) {
+    int* link = &buckets[entries[e].hash & (bucketCount - 1)];
+    while (*link != e) link = &entries[*link].chain;
+    *link = entries[e].chain;
+}
+
+void QueryCache::allocate() {
+    capacity = configuredCapacity;
+    entries = new Entry[capacity];
+    bucketCount = 1;
+    while (bucketCount < capacity * 2) bucketCount <<= 1;
+    buckets = new int[bucketCount];
+    for (int b = 0; b < bucketCount; b++) buckets[b] = -1;
+}
+
+// ---------- Lookup / Store ----------
+const CachedResult* QueryCache::find(const string &key) {
+    if (capacity == 0) {
+        if (configuredCapacity > 0) missCount++;
+        return nullptr;
+    }
+    int e = locate(key, hashOf(key));
+    if (e == -1 || entries[e].version != version) {
+        missCount++;
+        return nullptr;
+    }
+    unlink(e);
+    pushNewest(e);
+    hitCount++;
+    return &entries[e].result;
+}
+
+void QueryCache::store(const string &key, const CachedResult &result) {
+    if (capacity == 0) {
+        if (configuredCapacity == 0) return;
+        allocate();
+    }
+
+    uint64_t hash = hashOf(key);
+    int e = locate(key, hash);   // a stale copy of the same query
+    if (e != -1) {
+        unlink(e);
+    } else {
+        if (count < capacity) {
+            e = count++;
+        } else {
+            e = oldest;
+            unlink(e);
+            unchain(e);
+        }
+        entries[e].key = key;
+        entries[e].hash = hash;
+        int &head = buckets[hash & (bucketCount - 1)];
+        entries[e].chain = head;
+        head = e;
+    }
+    entries[e].version = version;
+    entries[e].result = result;
+    pushNewest(e);
+}
@@ -0,0 +1,108 @@
+#ifndef QUERYCACHE_HPP
+#define QUERYCACHE_HPP
+
+#include <string>
+#include <cstdint>
+#include "SkillDictionary.hpp"
+using namespace std;
+
+// ---------- Cached Result ----------
+const int CACHED_ROWS = 5;   // the HR engines' Top 5 tables
+
+struct CachedRow {
+    string name;
+    int matchedSkills;
+    int matchedWeight;
+    double score;   // as the engine prints it
+};
+
+// Everything one HR search shows: the rows of its table and the figures of
+// its performance summary, measured when the search actually ran
+struct CachedResult {
+    CachedRow rows[CACHED_ROWS];
+    int rowCount;
+    int matchedCount;
+    double searchTimeMS;
+    double sortTimeMS;
+    long long searchMemoryBytes;
+    long long sortMemoryBytes;
+
+    CachedResult();
+    void addRow(const string &name, int matchedSkills, int matchedWeight, double score);
+};
+
+// ---------- Query Cache ----------
+// Least recently used results of an HR engine's searches, keyed by the
+// canonical form of (job, skills, weights) from keyOf(). The same selection
+// in any order is one key, since neither the matches nor their ranking
+// depend on the order the skills were picked in.
+//
+// Entries are stamped with the dataset version they were computed on, and
+// invalidate() bumps the version when the engine reloads: older entries
+// then miss and are recycled like any other slot, so no sweep is needed.
+//
+// Capacity is set once per process with "--query-cache N" (0 turns the
+// cache off) and read when the first result is stored. Lookups hash the key
+// into a chained table and move the entry to the front of the LRU list, so a
+// repeated query costs a few string compares instead of a scan.
+class QueryCache {
+private:
+    struct Entry {
+        string key;
+        uint64_t hash;
+        unsigned version;
+        CachedResult result;
+        int newer, older;   // LRU list, -1 at either end
+        int chain;          // next entry in the same bucket, -1 at the end
+    };
+
+    Entry* entries;
+    int count;
+    int capacity;
+    int* buckets;       // first entry of each chain, -1 when empty
+    int bucketCount;    // power of two, at least twice the capacity
+    int newest, oldest;
+    unsigned version;
+    long long hitCount, missCount;
+
+    static int configuredCapacity;
+
+    static uint64_t hashOf(const string &key);
+    int locate(const string &key, uint64_t hash) const;
+    void allocate();
+    void unlink(int e);
+    void pushNewest(int e);
+    void unchain(int e);
+
+public:
+    static const int DEFAULT_CAPACITY = 64;
+
+    QueryCache();
+    ~QueryCache();
+
+    QueryCache(const QueryCache&) = delete;
+    QueryCache& operator=(const QueryCache&) = delete;
+
+    // Entries each cache may hold; call before the first search
+    static void configure(int entries) { configuredCapacity = entries < 0 ? 0 : entries; }
+    static int configured() { return configuredCapacity; }
+    // Value of "--query-cache N" on the command line, DEFAULT_CAPACITY when absent
+    static int capacityFromArgs(int argc, char* argv[]);
+
+    // Canonical key: the job, then the (skill, weight) pairs in ID order
+    static string keyOf(const string &job, const SkillId ids[], const int weights[], int n);
+
+    // The cached result for key, or nullptr on a miss
+    const CachedResult* find(const string &key);
+    // Keeps result for key, evicting the least recently used entry when full
+    void store(const string &key, const CachedResult &result);
+    // The loaded data changed: every entry stored so far is stale
+    void invalidate() { version++; }
+
+    bool enabled() const { return configuredCapacity > 0 || capacity > 0; }
+    unsigned datasetVersion() const { return version; }
+    long long hits() const { return hitCount; }
+    long long misses() const { return missCount; }
+};
+
+#endif // QUERYCACHE_HPP
@@ -0,0 +1,119 @@
+#include "ScoringKernel.hpp"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define SCORING_KERNEL_X86 1
+#include <immintrin.h>
+#endif
+
+// ---------- Scalar ----------
+void ScoringKernel::scoreScalar(const SkillMask masks[], int count, const WeightedQuery &query,
+                                int matchedSkills[], int matchedWeight[]) {
+    for (int i = 0; i < count; i++)
+        SkillBitset::score(masks[i], query, matchedSkills[i], matchedWeight[i]);
+}
+
+#ifdef SCORING_KERNEL_X86
+// ---------- AVX2 ----------
+// No 64-bit popcount in AVX2: count nibbles with a shuffle table, then
+// sum the bytes of each lane with SAD.
+__attribute__((target("avx2")))
+static inline __m256i popcount4x64(__m256i v) {
+    const __m256i lut = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                         0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i lowNibble = _mm256_set1_epi8(0x0f);
+    __m256i lo = _mm256_and_si256(v, lowNibble);
+    __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), lowNibble);
+    __m256i bytes = _mm256_add_epi8(_mm256_shuffle_epi8(lut, lo), _mm256_shuffle_epi8(lut, hi));
+    return _mm256_sad_epu8(bytes, _mm256_setzero_si256());
+}
+
+// Narrows four 64-bit lanes to four ints
+__attribute__((target("avx2")))
+static inline void store4x32(int* out, __m256i v) {
+    const __m256i pick = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+    _mm_storeu_si128((__m128i*)out, _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(v, pick)));
+}
+
+__attribute__((target("avx2")))
+static void scoreAvx2(const SkillMask masks[], int count, const WeightedQuery &query,
+                      int matchedSkills[], int matchedWeight[]) {
+    __m256i any = _mm256_set1_epi64x((long long)query.any);
+    __m256i planes[WEIGHT_PLANES];
+    for (int b = 0; b < query.planeCount; b++) planes[b] = _mm256_set1_epi64x((long long)query.planes[b]);
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256i m = _mm256_loadu_si256((const __m256i*)(masks + i));
+        __m256i skills = popcount4x64(_mm256_and_si256(m, any));
+        __m256i weight = _mm256_setzero_si256();
+        for (int b = query.planeCount - 1; b >= 0; b--) {   // Horner: weight = 2*weight + bits
+            __m256i bits = popcount4x64(_mm256_and_si256(m, planes[b]));
+            weight = _mm256_add_epi64(_mm256_add_epi64(weight, weight), bits);
+        }
+        store4x32(matchedSkills + i, skills);
+        store4x32(matchedWeight + i, weight);
+    }
+    ScoringKernel::scoreScalar(masks + i, count - i, query, matchedSkills + i, matchedWeight + i);
+}
+
+// ---------- AVX-512 ----------
+__attribute__((target("avx512f,avx512vpopcntdq")))
+static void scoreAvx512(const SkillMask masks[], int count, const WeightedQuery &query,
+                        int matchedSkills[], int matchedWeight[]) {
+    __m512i any = _mm512_set1_epi64((long long)query.any);
+    __m512i planes[WEIGHT_PLANES];
+    for (int b = 0; b < query.planeCount; b++) planes[b] = _mm512_set1_epi64((long long)query.planes[b]);
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m512i m = _mm512_loadu_si512((const void*)(masks + i));
+        __m512i skills = _mm512_popcnt_epi64(_mm512_and_si512(m, any));
+        __m512i weight = _mm512_setzero_si512();
+        for (int b = query.planeCount - 1; b >= 0; b--) {
+            __m512i bits = _mm512_popcnt_epi64(_mm512_and_si512(m, planes[b]));
+            weight = _mm512_add_epi64(_mm512_add_epi64(weight, weight), bits);
+        }
+        _mm512_mask_cvtepi64_storeu_epi32(matchedSkills + i, 0xFF, skills);
+        _mm512_mask_cvtepi64_storeu_epi32(matchedWeight + i, 0xFF, weight);
+    }
+    ScoringKernel::scoreScalar(masks + i, count - i, query, matchedSkills + i, matchedWeight + i);
+}
+#endif
+
+// ---------- Dispatch ----------
+typedef void (*KernelFn)(const SkillMask[], int, const WeightedQuery&, int[], int[]);
+
+struct KernelChoice {
+    KernelFn fn;
+    const char* name;
+};
+
+static KernelChoice pickKernel() {
+#ifdef SCORING_KERNEL_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vpopcntdq"))
+        return { scoreAvx512, "avx512" };
+    if (__builtin_cpu_supports("avx2"))
+        return { scoreAvx2, "avx2" };
+#endif
+    return { ScoringKernel::scoreScalar, "scalar" };
+}
+
+static const KernelChoice& kernel() {
+    static const KernelChoice choice = pickKernel();
+    return choice;
+}
+
+void ScoringKernel::score(const SkillMask masks[], int count, const WeightedQuery &query,
+                          int matchedSkills[], int matchedWeight[], double score[]) {
+    if (count <= 0) return;
+    kernel().fn(masks, count, query, matchedSkills, matchedWeight);
+    if (score) {
+        for (int i = 0; i < count; i++)
+            score[i] = (query.totalWeight > 0) ? (double)matchedWeight[i] / query.totalWeight : 0.0;
+    }
+}
+
+const char* ScoringKernel::name() {
+    return kernel().name;
+}
@@ -0,0 +1,25 @@
+#ifndef SCORINGKERNEL_HPP
+#define SCORINGKERNEL_HPP
+
+#include "SkillBitset.hpp"
+
+// ---------- Scoring Kernel ----------
+// Scores a contiguous array of candidate masks against one weighted query:
+//     matchedSkills[i] = popcount(masks[i] & query.any)
+//     matchedWeight[i] = sum over b of popcount(masks[i] & query.planes[b]) << b
+//     score[i]         = matchedWeight[i] / query.totalWeight   (optional)
+// The AVX-512 (8 masks per step) or AVX2 (4 masks per step) variant is
+// picked once at runtime from CPUID; other CPUs use the scalar loop.
+class ScoringKernel {
+public:
+    static void score(const SkillMask masks[], int count, const WeightedQuery &query,
+                      int matchedSkills[], int matchedWeight[], double score[] = nullptr);
+
+    // "avx512", "avx2" or "scalar"
+    static const char* name();
+
+    static void scoreScalar(const SkillMask masks[], int count, const WeightedQuery &query,
+                            int matchedSkills[], int matchedWeight[]);
+};
+
+#endif // SCORINGKERNEL_HPP
@@ -0,0 +1,38 @@
+#include "SkillBitset.hpp"
+
+SkillMask SkillBitset::maskOf(const SkillId ids[], int count) {
+    SkillMask mask = 0;
+    for (int i = 0; i < count; i++) addSkill(mask, ids[i]);
+    return mask;
+}
+
+bool SkillBitset::buildQuery(const SkillId ids[], const int weights[], int count, WeightedQuery &query) {
+    int perSkill[MASK_SKILLS] = {0};
+    query.any = 0;
+    query.totalWeight = 0;
+    for (int i = 0; i < count; i++) {
+        if (!fits(ids[i]) || weights[i] < 0) return false;
+        perSkill[ids[i]] += weights[i];
+        query.totalWeight += weights[i];
+        if (weights[i] > 0) query.any |= (SkillMask)1 << ids[i];
+    }
+
+    query.planeCount = 0;
+    for (int b = 0; b < WEIGHT_PLANES; b++) query.planes[b] = 0;
+    for (int id = 0; id < MASK_SKILLS; id++) {
+        int weight = perSkill[id];
+        if (weight >= (1 << WEIGHT_PLANES)) return false;
+        for (int b = 0; weight; b++, weight >>= 1) {
+            if (weight & 1) query.planes[b] |= (SkillMask)1 << id;
+            if (b + 1 > query.planeCount) query.planeCount = b + 1;
+        }
+    }
+    return true;
+}
+
+bool SkillBitset::buildPositionalQuery(const SkillId ids[], int count, WeightedQuery &query) {
+    int weights[MASK_SKILLS * 2];
+    if (count > MASK_SKILLS * 2) return false;
+    for (int i = 0; i < count; i++) weights[i] = count - i;
+    return buildQuery(ids, weights, count, query);
+}
@@ -0,0 +1,63 @@
+#ifndef SKILLBITSET_HPP
+#define SKILLBITSET_HPP
+
+#include <cstdint>
+#include "SkillDictionary.hpp"
+using namespace std;
+
+// ---------- Skill Masks ----------
+// One bit per SkillId. The cleaned vocabulary is well under 64 skills, so a
+// whole skill profile fits in a single machine word.
+typedef uint64_t SkillMask;
+const int MASK_SKILLS = 64;
+const int WEIGHT_PLANES = 8;   // per-skill weights up to 255
+
+// ---------- Weighted Query ----------
+// Skill weights split into bit planes: planes[b] holds every skill whose
+// weight has bit b set, so
+//     matchedWeight = sum over b of popcount(mask & planes[b]) << b
+// and a whole weighted match costs a few AND + popcount instructions.
+struct WeightedQuery {
+    SkillMask any;                    // every weighted skill
+    SkillMask planes[WEIGHT_PLANES];
+    int planeCount;
+    int totalWeight;
+};
+
+class SkillBitset {
+public:
+    static bool fits(SkillId id) { return id < MASK_SKILLS; }
+    // True when every interned skill has a bit, i.e. masks are exact
+    static bool vocabularyFits() { return SkillDictionary::global().size() <= MASK_SKILLS; }
+
+    static void addSkill(SkillMask &mask, SkillId id) {
+        if (fits(id)) mask |= (SkillMask)1 << id;
+    }
+    static SkillMask maskOf(const SkillId ids[], int count);
+
+    // Weights of repeated IDs are summed. Returns false when an ID has no bit
+    // or a summed weight needs more than WEIGHT_PLANES bits.
+    static bool buildQuery(const SkillId ids[], const int weights[], int count, WeightedQuery &query);
+    // Job seeker weighting: skill i of n weighs n - i
+    static bool buildPositionalQuery(const SkillId ids[], int count, WeightedQuery &query);
+
+    static int popcount(SkillMask mask) {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_popcountll(mask);
+#else
+        int bits = 0;
+        for (; mask; mask &= mask - 1) bits++;
+        return bits;
+#endif
+    }
+
+    static void score(SkillMask mask, const WeightedQuery &query, int &matchedSkills, int &matchedWeight) {
+        matchedSkills = popcount(mask & query.any);
+        int weight = 0;
+        for (int b = 0; b < query.planeCount; b++)
+            weight += popcount(mask & query.planes[b]) << b;
+        matchedWeight = weight;
+    }
+};
+
+#endif // SKILLBITSET_HPP
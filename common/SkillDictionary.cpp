@@ -0,0 +1,110 @@
+#include "SkillDictionary.hpp"
+#include "CsvLoader.hpp"
+#include <cctype>
+
+static char lowerChar(char c) {
+    return (char)tolower((unsigned char)c);
+}
+
+// ---------- Constructor / Destructor ----------
+SkillDictionary::SkillDictionary()
+    : entries(nullptr), count(0), capacity(0), table(nullptr), tableSize(0) {}
+
+SkillDictionary::~SkillDictionary() {
+    delete[] entries;
+    delete[] table;
+}
+
+SkillDictionary& SkillDictionary::global() {
+    static SkillDictionary dictionary;
+    return dictionary;
+}
+
+// ---------- Normalization ----------
+string SkillDictionary::normalize(string_view skill) {
+    return CsvReader::normalizeKey(skill);
+}
+
+// FNV-1a over the lowercase bytes
+uint32_t SkillDictionary::hashKey(string_view s) {
+    uint32_t hash = 2166136261u;
+    for (char c : s) {
+        hash ^= (unsigned char)lowerChar(c);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+bool SkillDictionary::equalsKey(const string &key, string_view s) {
+    if (key.size() != s.size()) return false;
+    for (size_t i = 0; i < s.size(); i++)
+        if (key[i] != lowerChar(s[i])) return false;
+    return true;
+}
+
+// ---------- Hash Table ----------
+// Returns the slot holding 's' or the empty slot where it would go.
+int SkillDictionary::findSlot(string_view s) const {
+    int mask = tableSize - 1;
+    int slot = (int)(hashKey(s) & (uint32_t)mask);
+    while (table[slot] != INVALID_SKILL && !equalsKey(entries[table[slot]].key, s))
+        slot = (slot + 1) & mask;
+    return slot;
+}
+
+void SkillDictionary::growEntries() {
+    int newCapacity = capacity == 0 ? 64 : capacity * 2;
+    Entry* newEntries = new Entry[newCapacity];
+    for (int i = 0; i < count; i++) {
+        newEntries[i].key.swap(entries[i].key);
+        newEntries[i].display.swap(entries[i].display);
+    }
+    delete[] entries;
+    entries = newEntries;
+    capacity = newCapacity;
+}
+
+void SkillDictionary::rehash(int newSize) {
+    delete[] table;
+    table = new SkillId[newSize];
+    tableSize = newSize;
+    for (int i = 0; i < tableSize; i++) table[i] = INVALID_SKILL;
+    for (int id = 0; id < count; id++)
+        table[findSlot(entries[id].key)] = (SkillId)id;
+}
+
+// ---------- Intern / Find ----------
+SkillId SkillDictionary::intern(string_view skill) {
+    string_view trimmed = CsvReader::trimView(skill);
+    if (trimmed.empty()) return INVALID_SKILL;
+
+    if (tableSize == 0) rehash(128);
+    int slot = findSlot(trimmed);
+    if (table[slot] != INVALID_SKILL) return table[slot];
+    if (count >= INVALID_SKILL) return INVALID_SKILL; // ID space exhausted
+
+    if (count == capacity) growEntries();
+    entries[count].key = normalize(trimmed);
+    entries[count].display = string(trimmed);
+    SkillId id = (SkillId)count++;
+
+    // Keep the load factor under 1/2
+    if (count * 2 > tableSize) rehash(tableSize * 2);
+    else table[slot] = id;
+    return id;
+}
+
+SkillId SkillDictionary::find(string_view skill) const {
+    if (tableSize == 0) return INVALID_SKILL;
+    string_view trimmed = CsvReader::trimView(skill);
+    if (trimmed.empty()) return INVALID_SKILL;
+    return table[findSlot(trimmed)];
+}
+
+void SkillDictionary::clear() {
+    delete[] entries;
+    delete[] table;
+    entries = nullptr;
+    table = nullptr;
+    count = capacity = tableSize = 0;
+}
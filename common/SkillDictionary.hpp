@@ -0,0 +1,57 @@
+#ifndef SKILLDICTIONARY_HPP
+#define SKILLDICTIONARY_HPP
+
+#include <string>
+#include <string_view>
+#include <cstdint>
+using namespace std;
+
+// ---------- Skill IDs ----------
+typedef uint16_t SkillId;
+const SkillId INVALID_SKILL = 0xFFFF;
+
+// ---------- Skill Dictionary ----------
+// Interns every skill once under its normalized key (trimmed, lowercase) and
+// hands out dense IDs, so records can store and compare plain integers.
+// Lookups never allocate: the hash and the key compare are case-insensitive.
+class SkillDictionary {
+private:
+    struct Entry {
+        string key;      // normalized form used for matching
+        string display;  // first spelling seen, used for printing
+    };
+
+    Entry* entries;
+    int count;
+    int capacity;
+    SkillId* table;      // open addressing, INVALID_SKILL marks an empty slot
+    int tableSize;
+
+    static uint32_t hashKey(string_view s);
+    static bool equalsKey(const string &key, string_view s);
+    int findSlot(string_view s) const;
+    void growEntries();
+    void rehash(int newSize);
+
+public:
+    SkillDictionary();
+    ~SkillDictionary();
+
+    SkillDictionary(const SkillDictionary&) = delete;
+    SkillDictionary& operator=(const SkillDictionary&) = delete;
+
+    // Process-wide table shared by the loaders and the matchers
+    static SkillDictionary& global();
+
+    static string normalize(string_view skill);
+
+    SkillId intern(string_view skill);      // adds the skill if it is new
+    SkillId find(string_view skill) const;  // INVALID_SKILL if unknown
+
+    const string& key(SkillId id) const { return entries[id].key; }
+    const string& display(SkillId id) const { return entries[id].display; }
+    int size() const { return count; }
+    void clear();
+};
+
+#endif // SKILLDICTIONARY_HPP
@@ -0,0 +1,136 @@
+#include "SkillExtractor.hpp"
+
+// ---------- Constructor / Destructor ----------
+SkillExtractor::SkillExtractor()
+    : skills(nullptr), skillCount(0), skillCapacity(0), columns(1), transitions(nullptr),
+      matchOf(nullptr), outputLink(nullptr), nodeCount(0), lastSeen(nullptr), calls(0) {
+    for (int c = 0; c < 256; c++) columnOf[c] = 0;
+}
+
+SkillExtractor::~SkillExtractor() {
+    release();
+    delete[] skills;
+}
+
+void SkillExtractor::release() {
+    delete[] transitions;
+    delete[] matchOf;
+    delete[] outputLink;
+    delete[] lastSeen;
+    transitions = matchOf = outputLink = lastSeen = nullptr;
+    nodeCount = 0;
+}
+
+// ---------- Build ----------
+int SkillExtractor::addSkill(string_view skill) {
+    if (skillCount == skillCapacity) {
+        int newCapacity = skillCapacity == 0 ? 32 : skillCapacity * 2;
+        string* grown = new string[newCapacity];
+        for (int i = 0; i < skillCount; i++) grown[i] = skills[i];
+        delete[] skills;
+        skills = grown;
+        skillCapacity = newCapacity;
+    }
+    skills[skillCount] = string(skill);
+    return skillCount++;
+}
+
+void SkillExtractor::build() {
+    release();
+
+    // Columns for the folded characters the vocabulary uses
+    for (int c = 0; c < 256; c++) columnOf[c] = 0;
+    columns = 1;
+    int maxNodes = 1;
+    for (int s = 0; s < skillCount; s++) {
+        maxNodes += (int)skills[s].size();
+        for (unsigned char ch : skills[s]) {
+            unsigned char f = fold(ch);
+            if (columnOf[f] == 0) columnOf[f] = columns++;
+        }
+    }
+    for (int c = 'A'; c <= 'Z'; c++) columnOf[c] = columnOf[fold((unsigned char)c)];
+
+    transitions = new int[maxNodes * columns];
+    matchOf = new int[maxNodes];
+    outputLink = new int[maxNodes];
+    for (int i = 0; i < maxNodes * columns; i++) transitions[i] = -1;
+    for (int i = 0; i < maxNodes; i++) matchOf[i] = outputLink[i] = -1;
+    nodeCount = 1;
+
+    // Trie of the folded skills; a repeated skill keeps its first index
+    for (int s = 0; s < skillCount; s++) {
+        int node = 0;
+        for (unsigned char ch : skills[s]) {
+            int &next = transitions[node * columns + columnOf[fold(ch)]];
+            if (next == -1) next = nodeCount++;
+            node = next;
+        }
+        if (!skills[s].empty() && matchOf[node] == -1) matchOf[node] = s;
+    }
+
+    // Breadth-first: missing edges borrow the failure node's edge, which
+    // turns the trie into a DFA; output links skip nodes without a match
+    int* failure = new int[nodeCount];
+    int* queue = new int[nodeCount];
+    int head = 0, tail = 0;
+    failure[0] = 0;
+    for (int c = 0; c < columns; c++) {
+        int &next = transitions[c];
+        if (next == -1) {
+            next = 0;
+        } else {
+            failure[next] = 0;
+            queue[tail++] = next;
+        }
+    }
+    while (head < tail) {
+        int node = queue[head++];
+        int fail = failure[node];
+        outputLink[node] = matchOf[fail] != -1 ? fail : outputLink[fail];
+        for (int c = 0; c < columns; c++) {
+            int &next = transitions[node * columns + c];
+            if (next == -1) {
+                next = transitions[fail * columns + c];
+            } else {
+                failure[next] = transitions[fail * columns + c];
+                queue[tail++] = next;
+            }
+        }
+    }
+    delete[] failure;
+    delete[] queue;
+
+    lastSeen = new int[skillCount > 0 ? skillCount : 1];
+    for (int s = 0; s < skillCount; s++) lastSeen[s] = 0;
+    calls = 0;
+}
+
+// ---------- Extract ----------
+int SkillExtractor::extract(string_view text, int found[]) {
+    if (!transitions) return 0;
+    calls++;
+    int count = 0;
+    int node = 0;
+    size_t n = text.size();
+
+    for (size_t i = 0; i < n; i++) {
+        node = transitions[node * columns + columnOf[(unsigned char)text[i]]];
+        bool wordAfter = i + 1 < n && isWordChar((unsigned char)text[i + 1]);
+
+        for (int m = matchOf[node] != -1 ? node : outputLink[node]; m != -1; m = outputLink[m]) {
+            int s = matchOf[m];
+            const string &skill = skills[s];
+            size_t start = i + 1 - skill.size();
+            // Whole words only: a skill edge that is a letter or digit must
+            // not run on into the neighbouring text ("C++" can end anywhere)
+            if (wordAfter && isWordChar((unsigned char)skill.back())) continue;
+            if (start > 0 && isWordChar((unsigned char)skill.front()) &&
+                isWordChar((unsigned char)text[start - 1])) continue;
+            if (lastSeen[s] == calls) continue;
+            lastSeen[s] = calls;
+            found[count++] = s;
+        }
+    }
+    return count;
+}
@@ -0,0 +1,62 @@
+#ifndef SKILLEXTRACTOR_HPP
+#define SKILLEXTRACTOR_HPP
+
+#include <string>
+#include <string_view>
+using namespace std;
+
+// ---------- Skill Extractor ----------
+// Aho–Corasick automaton over a skill vocabulary. One left-to-right scan of
+// the text reports every vocabulary skill it contains, however many skills
+// there are. Matching ignores ASCII case and only accepts whole words: a
+// skill that starts or ends with a letter or digit must not run on into one,
+// so "Java" is not found inside "JavaScript".
+//
+// The automaton is a full DFA over the characters that occur in the
+// vocabulary (case-folded); every other character shares one column, so
+// each text byte costs a single table lookup.
+class SkillExtractor {
+private:
+    string* skills;
+    int skillCount;
+    int skillCapacity;
+
+    unsigned char columnOf[256];   // folded byte -> DFA column, 0 = not in any skill
+    int columns;
+    int* transitions;              // nodeCount x columns
+    int* matchOf;                  // skill ending at this node, -1 if none
+    int* outputLink;               // next node on the suffix chain with a match, -1 if none
+    int nodeCount;
+
+    int* lastSeen;                 // per skill: extract() call that last reported it
+    int calls;
+
+    void release();
+
+public:
+    SkillExtractor();
+    ~SkillExtractor();
+
+    SkillExtractor(const SkillExtractor&) = delete;
+    SkillExtractor& operator=(const SkillExtractor&) = delete;
+
+    // Returns the skill's index; call build() after the last one
+    int addSkill(string_view skill);
+    void build();
+
+    int getSkillCount() const { return skillCount; }
+    const string& skill(int index) const { return skills[index]; }
+
+    // Writes the index of every skill found in text to found[] (room for
+    // getSkillCount() entries), each once, in order of first occurrence
+    int extract(string_view text, int found[]);
+
+    static bool isWordChar(unsigned char c) {
+        return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+    }
+    static unsigned char fold(unsigned char c) {
+        return (c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c;
+    }
+};
+
+#endif // SKILLEXTRACTOR_HPP
@@ -0,0 +1,146 @@
+#include "SkillIndex.hpp"
+#include <algorithm>
+
+// ---------- Constructor / Destructor ----------
+SkillIndex::SkillIndex()
+    : offsets(nullptr), postings(nullptr), skillCount(0), candidateCount(0), postingCount(0),
+      pendingCandidates(nullptr), pendingSkills(nullptr), pendingCount(0), pendingCapacity(0),
+      accSkills(nullptr), accWeight(nullptr) {}
+
+SkillIndex::~SkillIndex() {
+    clear();
+}
+
+void SkillIndex::clear() {
+    delete[] offsets;
+    delete[] postings;
+    delete[] pendingCandidates;
+    delete[] pendingSkills;
+    delete[] accSkills;
+    delete[] accWeight;
+    offsets = postings = pendingCandidates = accSkills = accWeight = nullptr;
+    pendingSkills = nullptr;
+    skillCount = candidateCount = postingCount = 0;
+    pendingCount = pendingCapacity = 0;
+}
+
+// ---------- Build ----------
+void SkillIndex::growPending() {
+    int newCapacity = pendingCapacity == 0 ? 1024 : pendingCapacity * 2;
+    int* newCandidates = new int[newCapacity];
+    SkillId* newSkills = new SkillId[newCapacity];
+    for (int i = 0; i < pendingCount; i++) {
+        newCandidates[i] = pendingCandidates[i];
+        newSkills[i] = pendingSkills[i];
+    }
+    delete[] pendingCandidates;
+    delete[] pendingSkills;
+    pendingCandidates = newCandidates;
+    pendingSkills = newSkills;
+    pendingCapacity = newCapacity;
+}
+
+void SkillIndex::add(int candidate, SkillId skill) {
+    if (skill == INVALID_SKILL || candidate < 0) return;
+    if (pendingCount == pendingCapacity) growPending();
+    pendingCandidates[pendingCount] = candidate;
+    pendingSkills[pendingCount] = skill;
+    pendingCount++;
+}
+
+// Counting sort of the pairs by skill. It is stable, so pairs added in
+// candidate order leave every posting list sorted.
+void SkillIndex::build(int candidates) {
+    delete[] offsets;
+    delete[] postings;
+    delete[] accSkills;
+    delete[] accWeight;
+
+    candidateCount = candidates;
+    skillCount = 0;
+    for (int i = 0; i < pendingCount; i++)
+        if (pendingSkills[i] + 1 > skillCount) skillCount = pendingSkills[i] + 1;
+
+    offsets = new int[skillCount + 1]();
+    for (int i = 0; i < pendingCount; i++) offsets[pendingSkills[i] + 1]++;
+    for (int s = 0; s < skillCount; s++) offsets[s + 1] += offsets[s];
+
+    postingCount = pendingCount;
+    postings = new int[postingCount > 0 ? postingCount : 1];
+    int* cursor = new int[skillCount > 0 ? skillCount : 1];
+    for (int s = 0; s < skillCount; s++) cursor[s] = offsets[s];
+    for (int i = 0; i < pendingCount; i++) {
+        // a candidate listing the same skill twice gets one posting
+        int &end = cursor[pendingSkills[i]];
+        if (end > offsets[pendingSkills[i]] && postings[end - 1] == pendingCandidates[i]) continue;
+        postings[end++] = pendingCandidates[i];
+    }
+    // close the gaps left by skipped duplicates
+    int write = 0;
+    for (int s = 0; s < skillCount; s++) {
+        int start = offsets[s];
+        offsets[s] = write;
+        for (int p = start; p < cursor[s]; p++) postings[write++] = postings[p];
+    }
+    offsets[skillCount] = write;
+    postingCount = write;
+    delete[] cursor;
+
+    accSkills = new int[candidateCount > 0 ? candidateCount : 1]();
+    accWeight = new int[candidateCount > 0 ? candidateCount : 1]();
+
+    delete[] pendingCandidates;
+    delete[] pendingSkills;
+    pendingCandidates = nullptr;
+    pendingSkills = nullptr;
+    pendingCount = pendingCapacity = 0;
+}
+
+// ---------- Query ----------
+int SkillIndex::postingsFor(const SkillId ids[], int count) const {
+    int total = 0;
+    for (int i = 0; i < count; i++) total += postingsFor(ids[i]);
+    return total;
+}
+
+// A posting costs a random read-modify-write where a scan costs a few
+// streaming instructions per candidate, so only take the index when the
+// postings touch at most a quarter of the pool.
+bool SkillIndex::isSelective(const SkillId ids[], int count) const {
+    if (!offsets || candidateCount == 0) return false;
+    return (long long)postingsFor(ids, count) * 4 <= candidateCount;
+}
+
+int SkillIndex::query(const SkillId ids[], const int weights[], int count,
+                      int hits[], int matchedSkills[], int matchedWeight[]) {
+    if (!offsets) return 0;
+    int hitCount = 0;
+
+    for (int i = 0; i < count; i++) {
+        if (ids[i] >= skillCount) continue;
+        bool repeated = false;
+        for (int j = 0; j < i; j++)
+            if (ids[j] == ids[i]) repeated = true;
+        if (repeated) continue;
+
+        int weight = weights[i];
+        for (int j = i + 1; j < count; j++)
+            if (ids[j] == ids[i]) weight += weights[j];
+
+        for (int p = offsets[ids[i]]; p < offsets[ids[i] + 1]; p++) {
+            int c = postings[p];
+            if (accSkills[c] == 0) hits[hitCount++] = c;
+            accSkills[c]++;
+            accWeight[c] += weight;
+        }
+    }
+
+    sort(hits, hits + hitCount);
+    for (int k = 0; k < hitCount; k++) {
+        int c = hits[k];
+        matchedSkills[k] = accSkills[c];
+        matchedWeight[k] = accWeight[c];
+        accSkills[c] = accWeight[c] = 0;
+    }
+    return hitCount;
+}
@@ -0,0 +1,64 @@
+#ifndef SKILLINDEX_HPP
+#define SKILLINDEX_HPP
+
+#include "SkillDictionary.hpp"
+
+// ---------- Skill Index ----------
+// Inverted index from SkillId to the candidates holding it. Candidates are
+// referred to by their load ordinal (0..candidateCount-1); every posting
+// list is sorted ascending. Postings are stored back to back (CSR layout):
+// skill s owns postings[offsets[s] .. offsets[s + 1]).
+//
+// Build: add() every (candidate, skill) pair in candidate order, then build().
+// Query: walks only the postings of the selected skills and accumulates the
+// weights per candidate, so candidates with none of them are never touched.
+class SkillIndex {
+private:
+    int* offsets;         // skillCount + 1 entries
+    int* postings;
+    int skillCount;
+    int candidateCount;
+    int postingCount;
+
+    // (candidate, skill) pairs collected before build()
+    int* pendingCandidates;
+    SkillId* pendingSkills;
+    int pendingCount;
+    int pendingCapacity;
+
+    // Per-candidate accumulators, all zero between queries
+    int* accSkills;
+    int* accWeight;
+
+    void growPending();
+
+public:
+    SkillIndex();
+    ~SkillIndex();
+
+    SkillIndex(const SkillIndex&) = delete;
+    SkillIndex& operator=(const SkillIndex&) = delete;
+
+    void add(int candidate, SkillId skill);
+    void build(int candidates);
+    void clear();
+
+    int getCandidateCount() const { return candidateCount; }
+    int postingsFor(SkillId skill) const {
+        return (skill < skillCount) ? offsets[skill + 1] - offsets[skill] : 0;
+    }
+    int postingsFor(const SkillId ids[], int count) const;
+
+    // True when the selected skills' postings cover a small enough share of
+    // the candidates that walking them beats scanning every candidate.
+    bool isSelective(const SkillId ids[], int count) const;
+
+    // Repeated IDs are merged (weights summed, matched once). Fills hits[]
+    // with every candidate holding at least one selected skill, ascending,
+    // plus its matched skill count and weight; returns the number of hits.
+    // The output arrays need room for getCandidateCount() entries.
+    int query(const SkillId ids[], const int weights[], int count,
+              int hits[], int matchedSkills[], int matchedWeight[]);
+};
+
+#endif // SKILLINDEX_HPP
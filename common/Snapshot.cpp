@@ -0,0 +1,303 @@
+#include "Snapshot.hpp"
+#include <fstream>
+#include <cstring>
+
+// Sections are padded to 8 bytes so the uint64_t arrays are aligned in the mapping
+static uint64_t alignUp(uint64_t offset) {
+    return (offset + 7) & ~(uint64_t)7;
+}
+
+static void appendU64(string &out, uint64_t value) {
+    out.append((const char*)&value, sizeof(value));
+}
+
+// ---------- Writer ----------
+SnapshotWriter::SnapshotWriter() : recordCount(0), sourceSize(0), sourceChecksum(0) {
+    appendU64(nameOffsets, 0);
+    appendU64(skillOffsets, 0);
+}
+
+void SnapshotWriter::addRecord(string_view name, const string_view skillNames[], int count) {
+    SkillMask mask = 0;
+    for (int i = 0; i < count; i++) {
+        SkillId id = dictionary.intern(skillNames[i]);
+        if (id == INVALID_SKILL) continue;
+        skills.append((const char*)&id, sizeof(id));
+        SkillBitset::addSkill(mask, id);
+    }
+    names.append(name.data(), name.size());
+    appendU64(nameOffsets, names.size());
+    appendU64(skillOffsets, skills.size() / sizeof(SkillId));
+    masks.append((const char*)&mask, sizeof(mask));
+    recordCount++;
+}
+
+bool SnapshotWriter::save(const string &filename) const {
+    string dictOffsets, dictPool;
+    appendU64(dictOffsets, 0);
+    for (int id = 0; id < dictionary.size(); id++) {
+        dictPool += dictionary.display((SkillId)id);
+        appendU64(dictOffsets, dictPool.size());
+    }
+
+    // Lay the sections out back to back, each on an 8-byte boundary
+    const string* sections[] = { &dictOffsets, &dictPool, &nameOffsets, &names, &skillOffsets, &skills, &masks };
+    const int sectionCount = 7;
+    uint64_t offsets[sectionCount];
+    uint64_t cursor = alignUp(sizeof(SnapshotHeader));
+    for (int i = 0; i < sectionCount; i++) {
+        offsets[i] = cursor;
+        cursor = alignUp(cursor + sections[i]->size());
+    }
+
+    string payload(cursor - sizeof(SnapshotHeader), '\0');
+    for (int i = 0; i < sectionCount; i++)
+        memcpy(&payload[offsets[i] - sizeof(SnapshotHeader)], sections[i]->data(), sections[i]->size());
+
+    SnapshotHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic = SNAPSHOT_MAGIC;
+    header.version = SNAPSHOT_VERSION;
+    header.recordCount = recordCount;
+    header.skillCount = (uint32_t)dictionary.size();
+    header.dictOffsets = offsets[0];
+    header.dictPool = offsets[1];
+    header.nameOffsets = offsets[2];
+    header.namePool = offsets[3];
+    header.skillOffsets = offsets[4];
+    header.skillIds = offsets[5];
+    header.masks = offsets[6];
+    header.fileSize = cursor;
+    header.sourceSize = sourceSize;
+    header.sourceChecksum = sourceChecksum;
+    header.payloadChecksum = Snapshot::checksum(payload.data(), payload.size());
+    header.headerChecksum = Snapshot::checksum((const char*)&header, sizeof(header));
+
+    ofstream out(filename, ios::binary | ios::trunc);
+    if (!out.is_open()) return false;
+    out.write((const char*)&header, sizeof(header));
+    out.write(payload.data(), payload.size());
+    return (bool)out;
+}
+
+bool SnapshotWriter::convertCsv(const string &csvFile, const string &snapshotFile) {
+    CsvReader reader(csvFile);
+    if (!reader.isOpen()) return false;
+
+    SnapshotWriter writer;
+    writer.setSourceSize(reader.size());
+    writer.setSourceChecksum(Snapshot::checksum(reader.mapping().begin(), reader.size()));
+    string_view* skillNames = new string_view[16];
+    int capacity = 16;
+    CsvRow row;
+    while (reader.next(row)) {
+        int count = 0;
+        SkillTokenizer tokens(row.skills);
+        string_view skill;
+        while (tokens.next(skill)) {
+            if (count == capacity) {
+                string_view* grown = new string_view[capacity * 2];
+                for (int i = 0; i < count; i++) grown[i] = skillNames[i];
+                delete[] skillNames;
+                skillNames = grown;
+                capacity *= 2;
+            }
+            skillNames[count++] = skill;
+        }
+        writer.addRecord(row.key, skillNames, count);
+    }
+    delete[] skillNames;
+    return writer.save(snapshotFile);
+}
+
+string SnapshotWriter::snapshotPathFor(const string &csvFile) {
+    size_t dot = csvFile.find_last_of('.');
+    size_t slash = csvFile.find_last_of("/\\");
+    if (dot == string::npos || (slash != string::npos && dot < slash)) return csvFile + ".bin";
+    return csvFile.substr(0, dot) + ".bin";
+}
+
+// ---------- Reader ----------
+Snapshot::Snapshot()
+    : header(nullptr), nameOffsets(nullptr), namePool(nullptr), skillOffsets(nullptr),
+      skillIds(nullptr), masks(nullptr), globalIds(nullptr), globalMasks(nullptr) {}
+
+Snapshot::~Snapshot() {
+    close();
+}
+
+void Snapshot::close() {
+    delete[] globalIds;
+    delete[] globalMasks;
+    globalIds = nullptr;
+    globalMasks = nullptr;
+    header = nullptr;
+    nameOffsets = skillOffsets = nullptr;
+    namePool = nullptr;
+    skillIds = nullptr;
+    masks = nullptr;
+    file.close();
+}
+
+// FNV-1a over 8-byte words (tail bytes one at a time), fast enough to run
+// on every open
+uint64_t Snapshot::checksum(const char* data, size_t length) {
+    uint64_t hash = 14695981039346656037ULL;
+    size_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+        uint64_t word;
+        memcpy(&word, data + i, sizeof(word));
+        hash = (hash ^ word) * 1099511628211ULL;
+    }
+    for (; i < length; i++)
+        hash = (hash ^ (unsigned char)data[i]) * 1099511628211ULL;
+    return hash;
+}
+
+// Every section must lie inside the file and every offset table must be
+// non-decreasing and end inside its pool, so the accessors never read past
+// the mapping
+bool Snapshot::validate() const {
+    const SnapshotHeader &h = *header;
+    uint64_t size = file.size();
+    if (h.fileSize != size) return false;
+
+    auto fits = [&](uint64_t offset, uint64_t bytes) {
+        return offset % 8 == 0 && offset >= sizeof(SnapshotHeader) && offset <= size && bytes <= size - offset;
+    };
+    uint64_t records = h.recordCount, skillTotal = h.skillCount;
+    if (!fits(h.dictOffsets, (skillTotal + 1) * 8) || !fits(h.nameOffsets, (records + 1) * 8) ||
+        !fits(h.skillOffsets, (records + 1) * 8) || !fits(h.masks, records * sizeof(SkillMask)))
+        return false;
+
+    const char* base = file.begin();
+    auto monotonic = [&](uint64_t tableOffset, uint64_t entries, uint64_t poolOffset, uint64_t unit) {
+        const uint64_t* table = (const uint64_t*)(base + tableOffset);
+        if (table[0] != 0) return false;
+        for (uint64_t i = 0; i < entries; i++)
+            if (table[i + 1] < table[i]) return false;
+        return fits(poolOffset, table[entries] * unit);
+    };
+    if (!monotonic(h.dictOffsets, skillTotal, h.dictPool, 1) ||
+        !monotonic(h.nameOffsets, records, h.namePool, 1) ||
+        !monotonic(h.skillOffsets, records, h.skillIds, sizeof(SkillId)))
+        return false;
+
+    const uint64_t* idEnd = (const uint64_t*)(base + h.skillOffsets) + records;
+    const SkillId* ids = (const SkillId*)(base + h.skillIds);
+    for (uint64_t i = 0; i < *idEnd; i++)
+        if (ids[i] >= skillTotal) return false;
+    return true;
+}
+
+bool Snapshot::open(const string &filename) {
+    close();
+    if (!file.open(filename)) return false;
+    if (file.size() < sizeof(SnapshotHeader)) {
+        file.close();
+        return false;
+    }
+
+    SnapshotHeader copy;
+    memcpy(&copy, file.begin(), sizeof(copy));
+    uint64_t expected = copy.headerChecksum;
+    copy.headerChecksum = 0;
+    if (copy.magic != SNAPSHOT_MAGIC || copy.version != SNAPSHOT_VERSION ||
+        checksum((const char*)&copy, sizeof(copy)) != expected ||
+        checksum(file.begin() + sizeof(SnapshotHeader), file.size() - sizeof(SnapshotHeader)) != copy.payloadChecksum) {
+        file.close();
+        return false;
+    }
+
+    header = (const SnapshotHeader*)file.begin();
+    if (!validate()) {
+        close();
+        return false;
+    }
+
+    const char* base = file.begin();
+    nameOffsets = (const uint64_t*)(base + header->nameOffsets);
+    namePool = base + header->namePool;
+    skillOffsets = (const uint64_t*)(base + header->skillOffsets);
+    skillIds = (const SkillId*)(base + header->skillIds);
+    masks = (const SkillMask*)(base + header->masks);
+
+    // Intern the snapshot dictionary in ID order and note whether it lines up
+    const uint64_t* dictOffsets = (const uint64_t*)(base + header->dictOffsets);
+    const char* dictPool = base + header->dictPool;
+    SkillId* remap = new SkillId[header->skillCount > 0 ? header->skillCount : 1];
+    bool identity = true;
+    for (uint32_t id = 0; id < header->skillCount; id++) {
+        string_view skill(dictPool + dictOffsets[id], dictOffsets[id + 1] - dictOffsets[id]);
+        remap[id] = SkillDictionary::global().intern(skill);
+        if (remap[id] != id) identity = false;
+    }
+
+    if (!identity) {
+        uint64_t total = skillOffsets[header->recordCount];
+        globalIds = new SkillId[total > 0 ? total : 1];
+        for (uint64_t i = 0; i < total; i++) globalIds[i] = remap[skillIds[i]];
+        globalMasks = new SkillMask[header->recordCount > 0 ? header->recordCount : 1];
+        for (uint32_t r = 0; r < header->recordCount; r++) {
+            globalMasks[r] = 0;
+            for (uint64_t i = skillOffsets[r]; i < skillOffsets[r + 1]; i++)
+                SkillBitset::addSkill(globalMasks[r], globalIds[i]);
+        }
+        skillIds = globalIds;
+        masks = globalMasks;
+    }
+    delete[] remap;
+    return true;
+}
+
+// ---------- Record Reader ----------
+RecordReader::RecordReader(const string &csvFile)
+    : csv(csvFile), nextRecord(0), buffer(nullptr), bufferCapacity(0) {
+    if (snapshot.open(SnapshotWriter::snapshotPathFor(csvFile)) && csv.isOpen() &&
+        snapshot.getSourceSize() != 0 &&
+        (snapshot.getSourceSize() != csv.size() ||
+         snapshot.getSourceChecksum() != Snapshot::checksum(csv.mapping().begin(), csv.size())))
+        snapshot.close();
+}
+
+RecordReader::~RecordReader() {
+    delete[] buffer;
+}
+
+int RecordReader::expectedRecords() const {
+    if (snapshot.isOpen()) return snapshot.getRecordCount() - nextRecord;
+    return csv.remainingLines();
+}
+
+bool RecordReader::next(string_view &name, const SkillId* &skills, int &count) {
+    if (snapshot.isOpen()) {
+        if (nextRecord >= snapshot.getRecordCount()) return false;
+        name = snapshot.name(nextRecord);
+        skills = snapshot.skills(nextRecord);
+        count = snapshot.skillCount(nextRecord);
+        nextRecord++;
+        return true;
+    }
+
+    CsvRow row;
+    if (!csv.next(row)) return false;
+    count = 0;
+    SkillTokenizer tokens(row.skills);
+    string_view skill;
+    while (tokens.next(skill)) {
+        SkillId id = SkillDictionary::global().intern(skill);
+        if (id == INVALID_SKILL) continue;
+        if (count == bufferCapacity) {
+            int newCapacity = bufferCapacity == 0 ? 16 : bufferCapacity * 2;
+            SkillId* grown = new SkillId[newCapacity];
+            for (int i = 0; i < count; i++) grown[i] = buffer[i];
+            delete[] buffer;
+            buffer = grown;
+            bufferCapacity = newCapacity;
+        }
+        buffer[count++] = id;
+    }
+    name = row.key;
+    skills = buffer;
+    return true;
+}
@@ -0,0 +1,160 @@
+#ifndef SNAPSHOT_HPP
+#define SNAPSHOT_HPP
+
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include "CsvLoader.hpp"
+#include "SkillDictionary.hpp"
+#include "SkillBitset.hpp"
+using namespace std;
+
+// ---------- Snapshot Layout ----------
+// Binary twin of a cleaned "Name,"skill, skill, ..."" CSV, written by the
+// resume cleaner next to it (candidates.csv -> candidates.bin). Every section
+// starts on an 8-byte boundary so the mapped file is read in place:
+//
+//   SnapshotHeader
+//   dictOffsets   uint64_t[skillCount + 1]   into dictPool
+//   dictPool      skill names (first spelling seen), no terminators
+//   nameOffsets   uint64_t[recordCount + 1]  into namePool
+//   namePool      record names, no terminators
+//   skillOffsets  uint64_t[recordCount + 1]  into skillIds
+//   skillIds      SkillId[]  snapshot dictionary IDs, in CSV order
+//   masks         SkillMask[recordCount]     bits of the IDs below MASK_SKILLS
+const uint32_t SNAPSHOT_MAGIC = 0x50414E53;   // "SNAP"
+const uint32_t SNAPSHOT_VERSION = 3;
+
+struct SnapshotHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t recordCount;
+    uint32_t skillCount;
+    uint64_t dictOffsets;      // section offsets from the start of the file
+    uint64_t dictPool;
+    uint64_t nameOffsets;
+    uint64_t namePool;
+    uint64_t skillOffsets;
+    uint64_t skillIds;
+    uint64_t masks;
+    uint64_t fileSize;
+    uint64_t sourceSize;       // bytes of the CSV it was converted from, 0 if none
+    uint64_t sourceChecksum;   // Snapshot::checksum() of that CSV's bytes
+    uint64_t payloadChecksum;  // over every byte after the header
+    uint64_t headerChecksum;   // over the header with this field zeroed
+};
+
+// ---------- Snapshot Writer ----------
+// Collects records in memory and writes them out in one go.
+class SnapshotWriter {
+private:
+    SkillDictionary dictionary;   // the snapshot's own IDs
+    string nameOffsets;
+    string names;
+    string skillOffsets;
+    string skills;
+    string masks;
+    uint32_t recordCount;
+    uint64_t sourceSize;
+    uint64_t sourceChecksum;
+
+public:
+    SnapshotWriter();
+
+    SnapshotWriter(const SnapshotWriter&) = delete;
+    SnapshotWriter& operator=(const SnapshotWriter&) = delete;
+
+    void addRecord(string_view name, const string_view skillNames[], int count);
+    bool save(const string &filename) const;
+    int getRecordCount() const { return (int)recordCount; }
+    void setSourceSize(uint64_t bytes) { sourceSize = bytes; }
+    void setSourceChecksum(uint64_t hash) { sourceChecksum = hash; }
+
+    // Rewrites a cleaned CSV as a snapshot; records read exactly as the engines read them
+    static bool convertCsv(const string &csvFile, const string &snapshotFile);
+    // "dir/foo.csv" -> "dir/foo.bin"
+    static string snapshotPathFor(const string &csvFile);
+};
+
+// ---------- Snapshot ----------
+// Read-only view of a snapshot file. open() checks the header, the section
+// bounds and both checksums, then interns the snapshot's skills into
+// SkillDictionary::global(). When they land on the same IDs (the snapshot
+// is the first thing loaded, or its skills are already known in the same
+// order) the ID and mask sections are used straight from the mapping;
+// otherwise they are translated once into owned arrays.
+class Snapshot {
+private:
+    MappedFile file;
+    const SnapshotHeader* header;
+    const uint64_t* nameOffsets;
+    const char* namePool;
+    const uint64_t* skillOffsets;
+    const SkillId* skillIds;
+    const SkillMask* masks;
+
+    SkillId* globalIds;       // only when the IDs had to be translated
+    SkillMask* globalMasks;
+
+    bool validate() const;
+
+public:
+    Snapshot();
+    ~Snapshot();
+
+    Snapshot(const Snapshot&) = delete;
+    Snapshot& operator=(const Snapshot&) = delete;
+
+    bool open(const string &filename);
+    void close();
+    bool isOpen() const { return header != nullptr; }
+
+    static uint64_t checksum(const char* data, size_t length);
+
+    int getRecordCount() const { return header ? (int)header->recordCount : 0; }
+    uint64_t getSourceSize() const { return header ? header->sourceSize : 0; }
+    uint64_t getSourceChecksum() const { return header ? header->sourceChecksum : 0; }
+    string_view name(int record) const {
+        return string_view(namePool + nameOffsets[record], nameOffsets[record + 1] - nameOffsets[record]);
+    }
+    int skillCount(int record) const { return (int)(skillOffsets[record + 1] - skillOffsets[record]); }
+    // IDs in SkillDictionary::global()
+    const SkillId* skills(int record) const { return skillIds + skillOffsets[record]; }
+    // Exact only while SkillBitset::vocabularyFits()
+    SkillMask mask(int record) const { return masks[record]; }
+};
+
+// ---------- Record Reader ----------
+// Yields (name, interned skill IDs) records from the snapshot next to a CSV
+// when there is one, and from the CSV itself otherwise, so the engines'
+// loaders have one loop for both. A snapshot whose CSV has since changed
+// size or content is taken as stale and ignored, so an edit that keeps the
+// byte count (reordered rows, swapped skills) still rereads the CSV. The
+// content is compared by checksum, not modification time, so a snapshot
+// checked in next to its CSV stays valid in a fresh clone; hashing the
+// mapped CSV costs a small fraction of parsing and interning it.
+class RecordReader {
+private:
+    Snapshot snapshot;
+    CsvReader csv;
+    int nextRecord;
+    SkillId* buffer;          // interned IDs of the current CSV row
+    int bufferCapacity;
+
+public:
+    explicit RecordReader(const string &csvFile);
+    ~RecordReader();
+
+    RecordReader(const RecordReader&) = delete;
+    RecordReader& operator=(const RecordReader&) = delete;
+
+    bool isOpen() const { return snapshot.isOpen() || csv.isOpen(); }
+    bool fromSnapshot() const { return snapshot.isOpen(); }
+    // Records still to come; exact from a snapshot, an upper bound from a CSV
+    int expectedRecords() const;
+
+    // name and skills stay valid until the next call
+    bool next(string_view &name, const SkillId* &skills, int &count);
+};
+
+#endif // SNAPSHOT_HPP
@@ -0,0 +1,104 @@
+#include "ThreadPool.hpp"
+#include <cstring>
+#include <cstdlib>
+
+int ThreadPool::requestedThreads = 0;
+
+// ---------- Constructor / Destructor ----------
+ThreadPool::ThreadPool(int threads)
+    : workers(nullptr), workerCount(threads > 1 ? threads - 1 : 0), task(nullptr),
+      total(0), grain(1), chunks(0), nextChunk(0), pending(0), generation(0), stopping(false) {
+    if (workerCount > 0) workers = new thread[workerCount];
+    for (int i = 0; i < workerCount; i++)
+        workers[i] = thread(&ThreadPool::workerLoop, this);
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        lock_guard<mutex> guard(lock);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (int i = 0; i < workerCount; i++) workers[i].join();
+    delete[] workers;
+}
+
+// ---------- Process-Wide Pool ----------
+void ThreadPool::configure(int threads) {
+    requestedThreads = threads;
+}
+
+ThreadPool& ThreadPool::global() {
+    static ThreadPool pool(requestedThreads > 0 ? requestedThreads
+                           : (thread::hardware_concurrency() > 0 ? (int)thread::hardware_concurrency() : 1));
+    return pool;
+}
+
+int ThreadPool::threadsFromArgs(int argc, char* argv[]) {
+    for (int i = 1; i + 1 < argc; i++) {
+        if (strcmp(argv[i], "--threads") == 0) {
+            int threads = atoi(argv[i + 1]);
+            return threads > 0 ? threads : 0;
+        }
+    }
+    return 0;
+}
+
+// ---------- Workers ----------
+void ThreadPool::runChunks() {
+    int chunk;
+    while ((chunk = nextChunk.fetch_add(1)) < chunks) {
+        int begin = chunk * grain;
+        int end = (begin + grain < total) ? begin + grain : total;
+        (*task)(chunk, begin, end);
+    }
+}
+
+void ThreadPool::workerLoop() {
+    long long seen = 0;
+    while (true) {
+        {
+            unique_lock<mutex> guard(lock);
+            wake.wait(guard, [&] { return stopping || generation != seen; });
+            if (stopping) return;
+            seen = generation;
+        }
+        runChunks();
+        {
+            lock_guard<mutex> guard(lock);
+            if (--pending == 0) finished.notify_one();
+        }
+    }
+}
+
+void ThreadPool::parallelFor(int n, int grain, const function<void(int, int, int)> &task) {
+    if (grain < 1) grain = 1;
+    int chunkTotal = chunkCount(n, grain);
+    if (chunkTotal == 0) return;
+
+    // One chunk or no workers: nothing to hand off
+    if (chunkTotal == 1 || workerCount == 0) {
+        for (int c = 0; c < chunkTotal; c++) {
+            int begin = c * grain;
+            task(c, begin, (begin + grain < n) ? begin + grain : n);
+        }
+        return;
+    }
+
+    {
+        lock_guard<mutex> guard(lock);
+        this->task = &task;
+        this->total = n;
+        this->grain = grain;
+        this->chunks = chunkTotal;
+        nextChunk.store(0);
+        pending = workerCount;
+        generation++;
+    }
+    wake.notify_all();
+    runChunks();
+
+    unique_lock<mutex> guard(lock);
+    finished.wait(guard, [&] { return pending == 0; });
+    this->task = nullptr;
+}
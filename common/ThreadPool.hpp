@@ -0,0 +1,107 @@
+#ifndef THREADPOOL_HPP
+#define THREADPOOL_HPP
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include "TopK.hpp"
+using namespace std;
+
+// Candidates per chunk. Scoring touches ~16 bytes per candidate (mask plus
+// two int outputs), so one chunk stays inside a 256 KB L2 cache.
+const int DEFAULT_GRAIN = 16384;
+
+// ---------- Thread Pool ----------
+// Fixed set of worker threads, created once per process. parallelFor()
+// splits [0, n) into chunks of `grain` items; chunk c always covers
+// [c * grain, (c + 1) * grain), so per-chunk results can be merged in chunk
+// order and come out the same for any thread count. The calling thread
+// runs chunks too. Calls must not be nested.
+class ThreadPool {
+private:
+    thread* workers;
+    int workerCount;
+
+    mutex lock;
+    condition_variable wake;
+    condition_variable finished;
+    const function<void(int, int, int)>* task;
+    int total;
+    int grain;
+    int chunks;
+    atomic<int> nextChunk;
+    int pending;             // workers still busy with the current call
+    long long generation;    // bumped once per parallelFor call
+    bool stopping;
+
+    static int requestedThreads;
+
+    void workerLoop();
+    void runChunks();
+
+public:
+    explicit ThreadPool(int threads);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Sets the size of the process-wide pool; call before the first global()
+    static void configure(int threads);
+    static ThreadPool& global();
+    // Value of "--threads N" on the command line, or 0 when absent
+    static int threadsFromArgs(int argc, char* argv[]);
+
+    int size() const { return workerCount + 1; }
+    static int chunkCount(int n, int grain) { return n <= 0 ? 0 : (n + grain - 1) / grain; }
+
+    // task(chunk, begin, end) for every chunk; returns when all are done
+    void parallelFor(int n, int grain, const function<void(int, int, int)> &task);
+};
+
+// ---------- Parallel Top-K ----------
+// Runs score(begin, end) over each chunk on the pool and keeps that chunk's
+// k best matches (by index), then merges the chunk winners in chunk order.
+// TopK breaks ties by push order, so equal items still come out in index
+// order and the result is identical to one serial TopK pass over [0, n).
+// Writes the winners best first to out[] and returns how many there are;
+// matchCount receives the number of indices for which isMatch() held.
+template<typename Score, typename IsMatch, typename Better>
+int parallelTopK(ThreadPool &pool, int n, int k, Score score, IsMatch isMatch, Better better,
+                 int out[], int &matchCount) {
+    int chunks = ThreadPool::chunkCount(n, DEFAULT_GRAIN);
+    int* chunkBest = new int[(chunks > 0 ? chunks : 1) * (k > 0 ? k : 1)];
+    int* chunkKept = new int[chunks > 0 ? chunks : 1];
+    int* chunkMatches = new int[chunks > 0 ? chunks : 1];
+
+    pool.parallelFor(n, DEFAULT_GRAIN, [&](int chunk, int begin, int end) {
+        score(begin, end);
+        TopK<int, Better> top(k, better);
+        int matches = 0;
+        for (int i = begin; i < end; i++) {
+            if (isMatch(i)) {
+                matches++;
+                top.push(i);
+            }
+        }
+        chunkMatches[chunk] = matches;
+        chunkKept[chunk] = top.take(chunkBest + chunk * k);
+    });
+
+    TopK<int, Better> merged(k, better);
+    matchCount = 0;
+    for (int c = 0; c < chunks; c++) {
+        matchCount += chunkMatches[c];
+        for (int j = 0; j < chunkKept[c]; j++) merged.push(chunkBest[c * k + j]);
+    }
+    int kept = merged.take(out);
+
+    delete[] chunkBest;
+    delete[] chunkKept;
+    delete[] chunkMatches;
+    return kept;
+}
+
+#endif // THREADPOOL_HPP
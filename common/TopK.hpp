@@ -0,0 +1,92 @@
+#ifndef TOPK_HPP
+#define TOPK_HPP
+
+// Selection only pays off when fewer than n items are wanted; otherwise the
+// engine's full sort is kept (k <= 0 asks for the complete ranking).
+inline bool isTopKSmall(int k, int n) {
+    return k > 0 && k < n;
+}
+
+// ---------- Top-K Selection ----------
+// Keeps the K best items seen so far in a bounded heap whose root is the
+// worst item kept. Each push is O(log K), so ranking n matches costs
+// O(n log K) instead of sorting all n when only the first K are shown.
+//
+// better(a, b) is the engine's own sort order (true when a ranks above b).
+// Items it cannot tell apart keep their push order, as a stable sort would.
+template<typename T, typename Better>
+class TopK {
+private:
+    struct Slot {
+        T item;
+        long long seq;   // push order, the final tie-break
+    };
+
+    Slot* heap;
+    int capacity;
+    int size;
+    long long pushed;
+    Better better;
+
+    bool worse(const Slot &a, const Slot &b) const {
+        if (better(a.item, b.item)) return false;
+        if (better(b.item, a.item)) return true;
+        return a.seq > b.seq;
+    }
+
+    void siftUp(int i) {
+        while (i > 0) {
+            int parent = (i - 1) / 2;
+            if (!worse(heap[i], heap[parent])) break;
+            Slot tmp = heap[i]; heap[i] = heap[parent]; heap[parent] = tmp;
+            i = parent;
+        }
+    }
+
+    void siftDown(int i) {
+        while (true) {
+            int worst = i;
+            int l = 2 * i + 1, r = l + 1;
+            if (l < size && worse(heap[l], heap[worst])) worst = l;
+            if (r < size && worse(heap[r], heap[worst])) worst = r;
+            if (worst == i) break;
+            Slot tmp = heap[i]; heap[i] = heap[worst]; heap[worst] = tmp;
+            i = worst;
+        }
+    }
+
+public:
+    TopK(int k, Better better)
+        : heap(k > 0 ? new Slot[k] : nullptr), capacity(k > 0 ? k : 0), size(0), pushed(0), better(better) {}
+    ~TopK() { delete[] heap; }
+
+    TopK(const TopK&) = delete;
+    TopK& operator=(const TopK&) = delete;
+
+    void push(const T &item) {
+        if (capacity == 0) return;
+        Slot slot{ item, pushed++ };
+        if (size < capacity) {
+            heap[size] = slot;
+            siftUp(size++);
+        } else if (worse(heap[0], slot)) {
+            heap[0] = slot;
+            siftDown(0);
+        }
+    }
+
+    int getSize() const { return size; }
+
+    // Writes the kept items best first and empties the heap
+    int take(T out[]) {
+        int n = size;
+        while (size > 0) {
+            out[size - 1] = heap[0].item;
+            heap[0] = heap[--size];
+            siftDown(0);
+        }
+        return n;
+    }
+};
+
+#endif // TOPK_HPP
@@ -1,5 +1,7 @@
 #include "OptimizedMerge_HR.hpp"
 
+namespace optimized_merge_hr {
+
 // Utils
 string Utils::trim(const string& str) {
     size_t start = str.find_first_not_of(" ");
@@ -10,29 +12,17 @@ string Utils::trim(const string& str) {
     return str.substr(start, end - start + 1);
 }
 
-string Utils::toLower(const string& str) {
-    string result = str;
-    transform(result.begin(), result.end(), result.begin(), [](unsigned char c) {
-        return tolower(c);
-    });
-    return result;
+const string& Utils::skillName(SkillId id) {
+    return SkillDictionary::global().display(id);
 }
 
-string Utils::normalizeSkill(const string& s) {
-    string res;
-    for (char c : s) {
-        if (!isspace(c)) res += tolower(c);
-    }
-    return res;
-}
-
-SkillNode* Utils::addSkill(SkillNode* head, const string& skill) {
+SkillNode* Utils::addSkill(SkillNode* head, SkillId skillId, NodeArena& arena) {
     for (SkillNode* temp = head; temp; temp = temp->next) {
-        if (Utils::toLower(temp->skill) == Utils::toLower(skill)) {
+        if (temp->skillId == skillId) {
             return head;
         }
     }
-    SkillNode* newNode = new SkillNode{ skill, nullptr };
+    SkillNode* newNode = arena.create<SkillNode>(skillId, nullptr);
     if (!head) {
         return newNode;
     }
@@ -53,7 +43,14 @@ int Utils::countSkills(SkillNode* head) {
     return count;
 }
 
-SkillNode* Utils::buildSkillList(const string& input, SkillNode* jobRoleSkills) {
+SkillMask Utils::skillMask(SkillNode* head) {
+    SkillMask mask = 0;
+    for (; head; head = head->next)
+        SkillBitset::addSkill(mask, head->skillId);
+    return mask;
+}
+
+SkillNode* Utils::buildSkillList(const string& input, SkillNode* jobRoleSkills, NodeArena& arena) {
     stringstream ss(input);
     string token;
     SkillNode* head = nullptr;
@@ -64,9 +61,10 @@ SkillNode* Utils::buildSkillList(const string& input, SkillNode* jobRoleSkills)
             continue;
         }
 
+        SkillId id = SkillDictionary::global().find(trimmed);
         for (SkillNode* js = jobRoleSkills; js; js = js->next) {
-            if (Utils::normalizeSkill(js->skill) == Utils::normalizeSkill(trimmed)) {
-                head = addSkill(head, js->skill);
+            if (js->skillId == id) {
+                head = addSkill(head, js->skillId, arena);
                 break;
             }
         }
@@ -78,44 +76,37 @@ void Utils::sortSkills(SkillNode*& head) {
     if (!head || !head->next) return;
     for (SkillNode* i = head; i && i->next; i = i->next) {
         for (SkillNode* j = i->next; j; j = j->next) {
-            if (Utils::toLower(i->skill) > Utils::toLower(j->skill)) {
-                swap(i->skill, j->skill);
+            if (SkillDictionary::global().key(i->skillId) > SkillDictionary::global().key(j->skillId)) {
+                swap(i->skillId, j->skillId);
             }
         }
     }
 }
 
 // File Loader
-SkillNode* FileLoader::parseSkills(const string & skillsStr) {
+SkillNode* FileLoader::parseSkills(string_view skillsStr, NodeArena& arena) {
     SkillNode* skillHead = nullptr;
-    string skill;
-    stringstream skillStream(skillsStr);
-    while (getline(skillStream, skill, ',')) {
-        if (!skill.empty() && skill[0] == ' ')
-            skill.erase(0, 1);
-        skillHead = Utils::addSkill(skillHead, skill);
+    SkillTokenizer tokens(skillsStr);
+    string_view skill;
+    while (tokens.next(skill)) {
+        SkillId id = SkillDictionary::global().intern(skill);
+        if (id != INVALID_SKILL) skillHead = Utils::addSkill(skillHead, id, arena);
     }
     return skillHead;
 }
 
-JobRole* FileLoader::loadJobs(const string& filename) {
-    ifstream file(filename);
-    if (!file.is_open()) {
+JobRole* FileLoader::loadJobs(const string& filename, NodeArena& arena) {
+    CsvReader reader(filename);
+    if (!reader.isOpen()) {
         cout << "Failed to open " << filename << "!" << endl;
         return nullptr;
     }
     JobRole* head = nullptr;
     JobRole* tail = nullptr;
-    string line;
-    while (getline(file, line)) {
-        if (line.empty()) continue;
-        stringstream ss(line);
-        string role, skillsStr;
-        getline(ss, role, ',');
-        getline(ss, skillsStr, '"');
-        getline(ss, skillsStr, '"');
-        SkillNode* skillHead = parseSkills(skillsStr);
-        JobRole* node = new JobRole{role, skillHead, nullptr, tail};
+    CsvRow row;
+    while (reader.next(row)) {
+        SkillNode* skillHead = parseSkills(row.skills, arena);
+        JobRole* node = arena.create<JobRole>(string(row.key), CsvReader::normalizeKey(row.key), skillHead, nullptr, tail);
         if (!head) {
             head = tail = node;
         } else { 
@@ -124,28 +115,28 @@ JobRole* FileLoader::loadJobs(const string& filename) {
             tail = node; 
         }
     }
-    file.close();
     return head;
 }
 
-Candidate* FileLoader::loadCandidates(const string& filename) {
-    ifstream file(filename);
-    if (!file.is_open()) {
+// Maps candidates.bin when the cleaner wrote one, parses the CSV otherwise.
+// Each candidate is followed in the arena by its own skill nodes.
+Candidate* FileLoader::loadCandidates(const string& filename, NodeArena& arena) {
+    RecordReader reader(filename);
+    if (!reader.isOpen()) {
         cout << "Failed to open " << filename << "!" << endl;
         return nullptr;
     }
     Candidate* head = nullptr;
     Candidate* tail = nullptr;
-    string line;
-    while (getline(file, line)) {
-        if (line.empty()) continue;
-        stringstream ss(line);
-        string name, skillsStr;
-        getline(ss, name, ',');
-        getline(ss, skillsStr, '"');
-        getline(ss, skillsStr, '"');
-        SkillNode* skillHead = parseSkills(skillsStr);
-        Candidate* node = new Candidate{name, skillHead, 0, 0, 0.0, nullptr};
+    string_view name;
+    const SkillId* ids;
+    int idCount;
+    while (reader.next(name, ids, idCount)) {
+        SkillNode* skillHead = nullptr;
+        Candidate* node = arena.create<Candidate>(string(name), nullptr, (SkillMask)0, 0, 0, 0.0, nullptr);
+        for (int k = 0; k < idCount; k++) skillHead = Utils::addSkill(skillHead, ids[k], arena);
+        node->skills = skillHead;
+        node->skillMask = Utils::skillMask(skillHead);
         if (!head) {
             head = tail = node;
         } else { 
@@ -153,19 +144,54 @@ Candidate* FileLoader::loadCandidates(const string& filename) {
             tail = node; 
         }
     }
-    file.close();
     return head;
 }
 
+void FileLoader::indexCandidates(Candidate* head, CandidateIndex& index) {
+    index.count = 0;
+    for (Candidate* c = head; c; c = c->next)
+        index.count++;
+    delete[] index.nodes;
+    delete[] index.masks;
+    index.nodes = new Candidate*[index.count];
+    index.masks = new SkillMask[index.count];
+    index.skills.clear();
+
+    int i = 0;
+    for (Candidate* c = head; c; c = c->next, i++) {
+        index.nodes[i] = c;
+        index.masks[i] = c->skillMask;
+        for (SkillNode* s = c->skills; s; s = s->next)
+            index.skills.add(i, s->skillId);
+    }
+    index.skills.build(index.count);
+    index.cache.clear();
+    index.results.invalidate();
+}
+
+// Candidate Index
+CandidateIndex::CandidateIndex() : nodes(nullptr), masks(nullptr), count(0) {}
+
+CandidateIndex::~CandidateIndex() {
+    delete[] nodes;
+    delete[] masks;
+}
+
+Candidate* CandidateIndex::relink() {
+    for (int i = 0; i < count; i++)
+        nodes[i]->next = (i + 1 < count) ? nodes[i + 1] : nullptr;
+    return count > 0 ? nodes[0] : nullptr;
+}
+
 // Optimized Linear Search
 JobRole* OptimizedLinearSearch::findRole(JobRole* head, const string& searchRole) {
     if (!head) {
         return nullptr;
     }
-    string target = Utils::toLower(searchRole);
+    string target = CsvReader::normalizeKey(searchRole);
     JobRole* result = nullptr;
     for (JobRole* temp = head; temp; temp = temp->next) {
-        if (Utils::toLower(temp->roleName) == target) {
+        if (temp->roleKey == target) {
             result = temp;
             break;
         }
@@ -173,10 +199,10 @@ JobRole* OptimizedLinearSearch::findRole(JobRole* head, const string& searchRole
     return result;
 }
 
-bool OptimizedLinearSearch::hasSkill(Candidate* c, const string& skill) {
+bool OptimizedLinearSearch::hasSkill(Candidate* c, SkillId skillId) {
     bool found = false;
     for (SkillNode* s = c->skills; s; s = s->next) {
-        if (Utils::toLower(s->skill) == Utils::toLower(skill)) {
+        if (s->skillId == skillId) {
             found = true;
             break;
         }
@@ -185,49 +211,115 @@ bool OptimizedLinearSearch::hasSkill(Candidate* c, const string& skill) {
 }
 
 // Merge Sort
+// Bottom-up over the runs already in the list. Each run is carried up
+// through the bins like a binary counter, merging with the bin it lands on,
+// so merges stay on recently touched nodes and no recursion is needed.
 Candidate* MergeSort::sortCandidates(Candidate* head) {
     if (!head || !head->next) {
         return head;
     }
-    Candidate* a;
-    Candidate* b;
-    splitList(head, &a, &b);
-    a = sortCandidates(a);
-    b = sortCandidates(b);
-    return merge(a, b);
-}
+    Candidate* bins[MAX_BINS] = {};
+    while (head) {
+        Candidate* run = head;
+        head = cutRun(run);
+        int i = 0;
+        for (; i < MAX_BINS - 1 && bins[i]; i++) {
+            run = merge(bins[i], run);
+            bins[i] = nullptr;
+        }
+        if (bins[i]) {
+            run = merge(bins[i], run);
+        }
+        bins[i] = run;
+    }
 
-void MergeSort::splitList(Candidate* source, Candidate** front, Candidate** back) {
-    Candidate* slow = source;
-    Candidate* fast = source->next;
-    while (fast) {
-        fast = fast->next;
-        if (fast) {
-            slow = slow->next;
-            fast = fast->next;
+    // Lower bins hold later runs
+    Candidate* sorted = nullptr;
+    for (int i = 0; i < MAX_BINS; i++) {
+        if (bins[i]) {
+            sorted = merge(bins[i], sorted);
         }
     }
-    *front = source;
-    *back = slow->next;
-    slow->next = nullptr;
+    return sorted;
 }
 
+// Detaches the leading non-increasing run and returns what follows it
+Candidate* MergeSort::cutRun(Candidate* head) {
+    while (head->next && head->score >= head->next->score) {
+        head = head->next;
+    }
+    Candidate* rest = head->next;
+    head->next = nullptr;
+    return rest;
+}
+
+// a must come from earlier in the list than b; it wins ties, which keeps
+// the sort stable
 Candidate* MergeSort::merge(Candidate* a, Candidate* b) {
-    if (!a) {
-        return b;
+    Candidate* result = nullptr;
+    Candidate** tail = &result;
+    while (a && b) {
+        if (a->score >= b->score) {
+            *tail = a;
+            a = a->next;
+        } else {
+            *tail = b;
+            b = b->next;
+        }
+        tail = &(*tail)->next;
     }
-    if (!b) {
-        return a;
+    *tail = a ? a : b;
+    return result;
+}
+
+// Counting Sort
+Candidate* CountingSort::sortCandidates(Candidate* head) {
+    int n = 0;
+    for (Candidate* c = head; c; c = c->next) {
+        n++;
+    }
+    if (n < 2) {
+        return head;
     }
 
-    Candidate* result = nullptr;
-    if (a->score >= b->score) {
-        result = a;
-        result->next = merge(a->next, b);
-    } else {
-        result = b;
-        result->next = merge(a, b->next);
+    Candidate** nodes = new Candidate*[n];
+    uint64_t* keys = new uint64_t[n];
+    int* order = new int[n];
+    int i = 0;
+    for (Candidate* c = head; c; c = c->next, i++) {
+        nodes[i] = c;
+        keys[i] = c->weightedScore;
+    }
+    CountingRank::rank(keys, n, order);
+    for (i = 0; i < n; i++) {
+        nodes[order[i]]->next = (i + 1 < n) ? nodes[order[i + 1]] : nullptr;
     }
+    Candidate* sorted = nodes[order[0]];
+    delete[] nodes;
+    delete[] keys;
+    delete[] order;
+    return sorted;
+}
+
+// Top-K Selection
+Candidate* TopSelect::selectCandidates(Candidate* head, int k) {
+    auto better = [](Candidate* a, Candidate* b) {
+        return a->score > b->score;
+    };
+    TopK<Candidate*, decltype(better)> top(k, better);
+    for (Candidate* c = head; c; c = c->next) {
+        if (c->matchedSkillCount > 0) {
+            top.push(c);
+        }
+    }
+
+    Candidate** best = new Candidate*[k];
+    int kept = top.take(best);
+    for (int i = 0; i < kept; i++) {
+        best[i]->next = (i + 1 < kept) ? best[i + 1] : nullptr;
+    }
+    Candidate* result = kept > 0 ? best[0] : nullptr;
+    delete[] best;
     return result;
 }
 
@@ -293,7 +385,7 @@ string InputUtils::getSkillsInput(JobRole* role) {
 
     int idx = 1;
     for (SkillNode* s = role->skills; s; s = s->next, idx++)
-        cout << " " << idx << ". " << s->skill << endl;
+        cout << " " << idx << ". " << Utils::skillName(s->skillId) << endl;
     cout << endl;
 
     int totalSkills = idx - 1;
@@ -302,6 +394,7 @@ string InputUtils::getSkillsInput(JobRole* role) {
         string choiceInput = InputUtils::getInput("Enter skill numbers to match (separated by comma): ");
         stringstream ss(choiceInput);
         string token;
+        NodeArena scratch;   // this attempt's selection, freed on return or retry
         SkillNode* selectedSkills = nullptr;
         bool invalid = false;
 
@@ -313,7 +406,7 @@ string InputUtils::getSkillsInput(JobRole* role) {
                 int i = 1;
                 for (SkillNode* s = role->skills; s; s = s->next, i++) {
                     if (i == num) {
-                        selectedSkills = Utils::addSkill(selectedSkills, s->skill);
+                        selectedSkills = Utils::addSkill(selectedSkills, s->skillId, scratch);
                         break;
                     }
                 }
@@ -330,7 +423,7 @@ string InputUtils::getSkillsInput(JobRole* role) {
 
         string skillStr;
         for (SkillNode* s = selectedSkills; s; s = s->next) {
-            skillStr += s->skill;
+            skillStr += Utils::skillName(s->skillId);
             if (s->next) skillStr += ",";
         }
         input = skillStr;
@@ -340,15 +433,16 @@ string InputUtils::getSkillsInput(JobRole* role) {
 }
 
 // Matcher
-MatchResult Matcher::matchCandidates(JobRole* role, Candidate* candidates, SkillNode* searchSkills) {
+bool Matcher::matchCandidates(JobRole* role, CandidateIndex& pool, SkillNode* searchSkills, CachedResult& result) {
     int totalSkills = Utils::countSkills(searchSkills);
     int* weights = new int[totalSkills];
-    int idx = 0, totalWeight = 0;
+    SkillId* searchIds = new SkillId[totalSkills];
+    int idx = 0;
 
     for (SkillNode* s = searchSkills; s; s = s->next, idx++) {
         int weight = 0;
         while (true) {
-            cout << "Weight for \"" << s->skill << "\": ";
+            cout << "Weight for \"" << Utils::skillName(s->skillId) << "\": ";
             string input; getline(cin, input);
             input = Utils::trim(input);
             stringstream ss(input);
@@ -361,63 +455,188 @@ MatchResult Matcher::matchCandidates(JobRole* role, Candidate* candidates, Skill
             cout << "Invalid input! Enter numbers between 1 and 10." << endl << endl;
         }
         weights[idx] = weight;
-        totalWeight += weight;
+        searchIds[idx] = s->skillId;
+    }
+
+    bool cached = rankCached(role, pool, searchIds, weights, totalSkills, result);
+    delete[] weights;
+    delete[] searchIds;
+    return cached;
+}
+
+bool Matcher::rankCached(JobRole* role, CandidateIndex& pool, const SkillId searchIds[], const int weights[], int totalSkills, CachedResult& result) {
+    string key = QueryCache::keyOf(role->roleKey, searchIds, weights, totalSkills);
+    const CachedResult* cached = pool.results.find(key);
+    if (cached) {
+        result = *cached;
+        return true;
+    }
+
+    MatchResult ranked = rankCandidates(pool, searchIds, weights, totalSkills);
+    result = CachedResult();
+    result.matchedCount = ranked.matchedCount;
+    result.searchTimeMS = ranked.searchTimeMS;
+    result.sortTimeMS = ranked.sortTimeMS;
+    result.searchMemoryBytes = ranked.searchMemoryBytes;
+    result.sortMemoryBytes = ranked.sortMemoryBytes;
+    int count = 0;
+    for (Candidate* c = ranked.sortedCandidates; c && count < TOP_CANDIDATES; c = c->next, count++) {
+        if (c->matchedSkillCount > 0)
+            result.addRow(c->name, c->matchedSkillCount, c->weightedScore, c->score);
     }
+    pool.results.store(key, result);
+    return false;
+}
+
+// Lists candidate i in pool.cache; its hit mask is only built here when the
+// skills have no mask bits, rescore() derives it from pool.masks otherwise
+static void recordMatch(CandidateIndex& pool, int i) {
+    if (pool.cache.usesSkillMasks()) {
+        pool.cache.add(i);
+        return;
+    }
+    SkillMask hitMask = 0;
+    for (SkillNode* s = pool.nodes[i]->skills; s; s = s->next)
+        hitMask |= pool.cache.slotOf(s->skillId);
+    pool.cache.add(i, hitMask);
+}
+
+MatchResult Matcher::rankCandidates(CandidateIndex& pool, const SkillId searchIds[], const int weights[], int totalSkills) {
+    int totalWeight = 0;
+    for (int i = 0; i < totalSkills; i++)
+        totalWeight += weights[i];
+
+    // Posting lists for rare skills; otherwise ScoringKernel over the masks
+    // when every skill has a bit, list walk as the last resort
+    WeightedQuery query;
+    bool useBitset = SkillBitset::vocabularyFits() &&
+                     SkillBitset::buildQuery(searchIds, weights, totalSkills, query);
     
+    MemoryPhase searchMemory(ALLOC_SEARCH);
+    searchMemory.start();
     auto startSearch = chrono::high_resolution_clock::now();
     int candidateCount = 0;
-    int candidateSkillCount = 0;
-    int roleSkillCount = 0;
-    for (SkillNode* s = role->skills; s; s = s->next)
-        roleSkillCount++;
-    for (Candidate* c = candidates; c; c = c->next) {
-        c->matchedSkillCount = 0;
-        c->weightedScore = 0;
-        c->score = 0.0;
-        idx = 0;
-        for (SkillNode* s = searchSkills; s; s = s->next, idx++) {
-            for (SkillNode* cSkill = c->skills; cSkill; cSkill = cSkill->next) {
-                if (Utils::toLower(s->skill) == Utils::toLower(cSkill->skill)) {
-                    c->matchedSkillCount++;
-                    c->weightedScore += weights[idx];
-                    break;
+
+    // Same skills as the last search, only the weights changed: rescore the
+    // cached matches instead of searching again
+    MatchCache& cache = pool.cache;
+    bool cached = cache.rescore(searchIds, weights, totalSkills, pool.masks);
+    bool record = !cached && cache.begin(searchIds, weights, totalSkills);
+
+    Candidate* candidates = nullptr;
+    if (cached) {
+        Candidate* tail = nullptr;
+        for (int k = 0; k < cache.size(); k++) {
+            Candidate* c = pool.nodes[cache.candidate(k)];
+            c->matchedSkillCount = cache.matchedSkills(k);
+            c->weightedScore = cache.matchedWeight(k);
+            c->score = (totalWeight > 0) ? (double(c->weightedScore) / totalWeight) * 100.0 : 0.0;
+            c->next = nullptr;
+            if (!candidates) {
+                candidates = tail = c;
+            } else {
+                tail->next = c;
+                tail = c;
+            }
+            candidateCount++;
+        }
+    } else if (pool.skills.isSelective(searchIds, totalSkills)) {
+        // Rare skills: link up only the candidates on their posting lists
+        int* hits = new int[pool.count];
+        int* hitSkills = new int[pool.count];
+        int* hitWeight = new int[pool.count];
+        int hitCount = pool.skills.query(searchIds, weights, totalSkills, hits, hitSkills, hitWeight);
+        Candidate* tail = nullptr;
+        for (int k = 0; k < hitCount; k++) {
+            Candidate* c = pool.nodes[hits[k]];
+            c->matchedSkillCount = hitSkills[k];
+            c->weightedScore = hitWeight[k];
+            c->score = (totalWeight > 0) ? (double(c->weightedScore) / totalWeight) * 100.0 : 0.0;
+            c->next = nullptr;
+            if (!candidates) {
+                candidates = tail = c;
+            } else {
+                tail->next = c;
+                tail = c;
+            }
+            if (record) recordMatch(pool, hits[k]);
+            candidateCount++;
+        }
+        delete[] hits;
+        delete[] hitSkills;
+        delete[] hitWeight;
+    } else {
+        int* kernelSkills = nullptr;
+        int* kernelWeight = nullptr;
+        if (useBitset) {
+            kernelSkills = new int[pool.count];
+            kernelWeight = new int[pool.count];
+            ScoringKernel::score(pool.masks, pool.count, query, kernelSkills, kernelWeight);
+        }
+
+        candidates = pool.relink();
+        for (Candidate* c = candidates; c; c = c->next) {
+            c->matchedSkillCount = 0;
+            c->weightedScore = 0;
+            c->score = 0.0;
+            if (useBitset) {
+                c->matchedSkillCount = kernelSkills[candidateCount];
+                c->weightedScore = kernelWeight[candidateCount];
+            } else {
+                for (int k = 0; k < totalSkills; k++) {
+                    for (SkillNode* cSkill = c->skills; cSkill; cSkill = cSkill->next) {
+                        if (searchIds[k] == cSkill->skillId) {
+                            c->matchedSkillCount++;
+                            c->weightedScore += weights[k];
+                            break;
+                        }
+                    }
                 }
             }
+            c->score = (totalWeight > 0) ? (double(c->weightedScore) / totalWeight) * 100.0 : 0.0;
+            if (record && c->matchedSkillCount > 0) recordMatch(pool, candidateCount);
+            candidateCount++;
         }
-        c->score = (totalWeight > 0) ? (double(c->weightedScore) / totalWeight) * 100.0 : 0.0;
-        candidateCount++;
-        for (SkillNode* cSkill = c->skills; cSkill; cSkill = cSkill->next)
-            candidateSkillCount++;
+        delete[] kernelSkills;
+        delete[] kernelWeight;
     }
+    cache.finish();
     auto endSearch = chrono::high_resolution_clock::now();
     double optimizedTime = chrono::duration<double, std::milli>(endSearch - startSearch).count();
+    searchMemory.stop();
 
-    auto startSort = chrono::high_resolution_clock::now();
-    Candidate* sorted = MergeSort::sortCandidates(candidates);
-    auto endSort = chrono::high_resolution_clock::now();
-    double mergeTime = chrono::duration<double, std::milli>(endSort - startSort).count();
-
-    int selectedCount = Utils::countSkills(searchSkills);
     int matchedCount = 0;
-    for (Candidate* c = sorted; c; c = c->next) {
+    for (Candidate* c = candidates; c; c = c->next) {
         if (c->matchedSkillCount > 0) {
             matchedCount++;
-        } 
+        }
     }
-    size_t optimizedMemory = sizeof(SkillNode*) * 3 + sizeof(string) * (selectedCount + 1);
-    size_t mergeMemory =  sizeof(Candidate*) * 3 + sizeof(Candidate) * matchedCount + (matchedCount/2) * sizeof(Candidate*);
-    
-    delete[] weights;
-    return { sorted, optimizedTime, mergeTime, optimizedMemory, mergeMemory };
+
+    MemoryPhase sortMemory(ALLOC_SORT);
+    sortMemory.start();
+    auto startSort = chrono::high_resolution_clock::now();
+    Candidate* sorted;
+    if (Ranking::selectTop(TOP_CANDIDATES, matchedCount)) {
+        sorted = TopSelect::selectCandidates(candidates, TOP_CANDIDATES);
+    } else if (Ranking::counting()) {
+        sorted = CountingSort::sortCandidates(candidates);
+    } else {
+        sorted = MergeSort::sortCandidates(candidates);
+    }
+    auto endSort = chrono::high_resolution_clock::now();
+    double mergeTime = chrono::duration<double, std::milli>(endSort - startSort).count();
+    sortMemory.stop();
+
+    return { sorted, optimizedTime, mergeTime, searchMemory.heapDeltaBytes(), sortMemory.heapDeltaBytes(), matchedCount };
 }
 
-void optimized_merge() {
+void optimized_merge(JobRole* jobs, CandidateIndex& pool) {
     cout << "===============================================" << endl;
     cout << "            HR Job Matching System" << endl;
     cout << "     Optimized Linear Search + Merge Sort" << endl;
     cout << "===============================================" << endl;
 
-bool exitProgram = false;
+    bool exitProgram = false;
     bool showMainMenu = true;
 
     while (!exitProgram) {
@@ -433,40 +652,34 @@ bool exitProgram = false;
             }
         }
 
-        JobRole* jobs = FileLoader::loadJobs("job_description/mergejob.csv");
-        Candidate* candidates = FileLoader::loadCandidates("resume/candidates.csv");
+        NodeArena scratch;   // this search's skill list, freed each iteration
         JobRole* role = InputUtils::getValidJobRole(jobs);
         string skillInput = InputUtils::getSkillsInput(role);
-        SkillNode* searchSkills = Utils::buildSkillList(skillInput, role->skills);
+        SkillNode* searchSkills = Utils::buildSkillList(skillInput, role->skills, scratch);
 
-        auto result = Matcher::matchCandidates(role, candidates, searchSkills);
+        CachedResult result;
+        bool cached = Matcher::matchCandidates(role, pool, searchSkills, result);
+        AllocPhase previousPhase = AllocStats::enter(ALLOC_DISPLAY);
         cout << endl << "======================= JOB MATCHING =======================" << endl;
         Utils::sortSkills(searchSkills);
         cout << "Skills: ";
         for (SkillNode* s = searchSkills; s; s = s->next) {
-            cout << s->skill;
+            cout << Utils::skillName(s->skillId);
             if (s->next) cout << ", ";
         }
         cout << endl;
 
-        int totalMatch = 0;
-        for (Candidate* c = result.sortedCandidates; c; c = c->next)
-            if (c->matchedSkillCount > 0) {
-                totalMatch++;
-            }
-
-        cout << "Total Matching Candidates: " << totalMatch << endl << endl;
+        cout << "Total Matching Candidates: " << result.matchedCount << endl << endl;
         cout << "Top 5 candidates:" << endl;
         cout << "------------------------------------------------------------" << endl;
         cout << left << setw(16) << "Candidates"<< setw(17) << "Matched Skills" << setw(18) << "Weighted Score" << "Score (%)" << endl;
         cout << "------------------------------------------------------------" << endl;
 
-        int count = 0;
-        for (Candidate* c = result.sortedCandidates; c && count < 5; c = c->next, count++) {
-            if (c->matchedSkillCount > 0) {
-                cout << left << setw(22) << c->name << setw(17) << c->matchedSkillCount<< setw(13) << c->weightedScore << fixed << setprecision(2) << c->score << endl;
-            }
+        for (int i = 0; i < result.rowCount; i++) {
+            const CachedRow& c = result.rows[i];
+            cout << left << setw(22) << c.name << setw(17) << c.matchedSkills << setw(13) << c.matchedWeight << fixed << setprecision(2) << c.score << endl;
         }
+        AllocStats::leave(previousPhase);
 
         while (!exitProgram) {
             cout << endl << "[ ACTION ]" << endl;
@@ -478,9 +691,15 @@ bool exitProgram = false;
             if (postChoice == "1") {
                 cout << endl << "============ PERFORMANCE SUMMARY ==============" << endl;
                 cout << "Optimized Linear Search Time   : " << fixed << setprecision(3) << result.searchTimeMS << " ms" << endl;
-                cout << "Optimized Linear Search Memory : " << fixed << setprecision(3) << (result.searchMemoryKB / 1024.0) << " KB" << endl; 
+                cout << "Optimized Linear Search Memory : " << fixed << setprecision(3) << (result.searchMemoryBytes / 1024.0) << " KB" << endl; 
                 cout << "Merge Sort Time                : " << fixed << setprecision(3) << result.sortTimeMS << " ms" << endl;
-                cout << "Merge Sort Memory              : " << fixed << setprecision(3) << (result.sortMemoryKB / 1024.0) << " KB" << endl;
+                cout << "Merge Sort Memory              : " << fixed << setprecision(3) << (result.sortMemoryBytes / 1024.0) << " KB" << endl;
+                if (pool.results.enabled())
+                    cout << "Query Cache                    : " << (cached ? "hit" : "miss") << " (" << pool.results.hits()
+                         << " hits, " << pool.results.misses() << " misses)" << endl;
+                cout << "Process RSS                    : " << MemoryStats::currentRssKB() << " KB" << endl;
+                cout << "Peak RSS                       : " << MemoryStats::peakRssKB() << " KB" << endl;
+                AllocStats::printReport();
             } else if (postChoice == "2") {
                 showMainMenu = false;
                 break; 
@@ -492,7 +711,51 @@ bool exitProgram = false;
     cout << endl << "Thank you for using the Job Matching System. Goodbye!" << endl;
 }
 
-int main() {
-    optimized_merge();
-    return 0;
-}
\ No newline at end of file
+// ---------- Engine ----------
+const int MAX_QUERY_SKILLS = 20;   // skills runQuery() passes through
+
+class OptimizedMergeHREngine : public Engine {
+private:
+    NodeArena nodes;   // every job, candidate and skill node; outlives the lists below
+    JobRole* jobs = nullptr;
+    CandidateIndex pool;
+
+public:
+    const char* name() const override { return "Linked List Merge Sort and Optimized Linear Search (HR)"; }
+
+    bool loadFrom(const string& jobsFile, const string& candidatesFile) override {
+        jobs = FileLoader::loadJobs(jobsFile, nodes);
+        Candidate* candidates = FileLoader::loadCandidates(candidatesFile, nodes);
+        if (!jobs || !candidates) return false;
+        FileLoader::indexCandidates(candidates, pool);
+        return true;
+    }
+
+    void query() override { optimized_merge(jobs, pool); }
+
+    int recordCount() const override { return pool.count; }
+
+    bool runQuery(const EngineQuery& query) override {
+        JobRole* role = OptimizedLinearSearch::findRole(jobs, query.jobTitle);
+        if (!role) return false;
+
+        SkillId ids[MAX_QUERY_SKILLS];
+        int weights[MAX_QUERY_SKILLS];
+        int count = resolveQuerySkills(query, ids, weights, MAX_QUERY_SKILLS);
+        CachedResult result;
+        if (count > 0) Matcher::rankCached(role, pool, ids, weights, count, result);
+        return true;
+    }
+};
+
+Engine* createEngine() { return new OptimizedMergeHREngine(); }
+
+} // namespace optimized_merge_hr
+
+#ifndef ENGINE_NO_MAIN
+int main(int argc, char* argv[]) {
+    Ranking::configure(Ranking::modeFromArgs(argc, argv));
+    QueryCache::configure(QueryCache::capacityFromArgs(argc, argv));
+    return runEngine(optimized_merge_hr::createEngine());
+}
+#endif
\ No newline at end of file
@@ -10,16 +10,34 @@
 #include <cctype>
 #include <chrono>
 #include <cmath>
+#include "../../common/CsvLoader.hpp"
+#include "../../common/Snapshot.hpp"
+#include "../../common/SkillDictionary.hpp"
+#include "../../common/SkillBitset.hpp"
+#include "../../common/ScoringKernel.hpp"
+#include "../../common/SkillIndex.hpp"
+#include "../../common/MatchCache.hpp"
+#include "../../common/QueryCache.hpp"
+#include "../../common/TopK.hpp"
+#include "../../common/CountingRank.hpp"
+#include "../../common/MemoryStats.hpp"
+#include "../../common/NodeArena.hpp"
+#include "../../common/Engine.hpp"
 using namespace std;
 
+namespace optimized_merge_hr {
+
+const int TOP_CANDIDATES = 5;   // rows in the Top 5 table
+
 struct SkillNode {
-    string skill;
+    SkillId skillId;
     SkillNode* next;
 };
 
 struct Candidate {
     string name;
     SkillNode* skills;
+    SkillMask skillMask;   // bitset of skills, exact when SkillBitset::vocabularyFits()
     int matchedSkillCount;
     int weightedScore;
     double score;
@@ -28,51 +46,89 @@ struct Candidate {
 
 struct JobRole {
     string roleName;
+    string roleKey;   // normalized name, what findRole compares
     SkillNode* skills;
     JobRole* next;
     JobRole* prev;
 };
 
+// Load-order view of the candidate list, built once after loading: node
+// pointers, packed masks for ScoringKernel, and the skill -> candidate index.
+// Sorting relinks the nodes, so relink() restores the full list in load order.
+// cache keeps the last search's matches for weight-only changes, results
+// the shown rows of recent queries.
+struct CandidateIndex {
+    Candidate** nodes;
+    SkillMask* masks;
+    int count;
+    SkillIndex skills;
+    MatchCache cache;
+    QueryCache results;
+
+    CandidateIndex();
+    ~CandidateIndex();
+    Candidate* relink();
+};
+
 struct MatchResult {
     Candidate* sortedCandidates;
     double searchTimeMS;
     double sortTimeMS;
-    size_t searchMemoryKB;
-    size_t sortMemoryKB;
+    long long searchMemoryBytes;   // measured heap deltas
+    long long sortMemoryBytes;
+    int matchedCount;
 };
 
 class Utils {
 public:
     static string trim(const string& str);
-    static string toLower(const string& str);
-    static string normalizeSkill(const string& s);
-    static SkillNode* addSkill(SkillNode* head, const string& skill);
+    static const string& skillName(SkillId id);
+    static SkillNode* addSkill(SkillNode* head, SkillId skillId, NodeArena& arena);
     static int countSkills(SkillNode* head);
-    static SkillNode* buildSkillList(const string& input, SkillNode* jobRoleSkills);
+    static SkillMask skillMask(SkillNode* head);
+    static SkillNode* buildSkillList(const string& input, SkillNode* jobRoleSkills, NodeArena& arena);
     static void sortSkills(SkillNode*& head);
 };
 
 class FileLoader {
 public:
-    static SkillNode* parseSkills(const string & skillsStr);
-    static JobRole* loadJobs(const string& filename);
-    static Candidate* loadCandidates(const string& filename);
+    static SkillNode* parseSkills(string_view skillsStr, NodeArena& arena);
+    static JobRole* loadJobs(const string& filename, NodeArena& arena);
+    static Candidate* loadCandidates(const string& filename, NodeArena& arena);
+    static void indexCandidates(Candidate* head, CandidateIndex& index);
 };
 
 class OptimizedLinearSearch {
 public:
     static JobRole* findRole(JobRole* head, const string& searchRole);
-    static bool hasSkill(Candidate* c, const string& skill);
+    static bool hasSkill(Candidate* c, SkillId skillId);
 };
 
+// Iterative natural merge sort: stable, constant stack, one scan when the
+// list is already in order
 class MergeSort {
 public:
     static Candidate* sortCandidates(Candidate* head);
 private:
-    static void splitList(Candidate* source, Candidate** front, Candidate** back);
+    static const int MAX_BINS = 48;   // bin i holds about 2^i runs
+    static Candidate* cutRun(Candidate* head);
     static Candidate* merge(Candidate* a, Candidate* b);
 };
 
+// Stable counting sort in the same order as MergeSort: score is weightedScore
+// over the query's total weight, so the integer weight is the whole key
+class CountingSort {
+public:
+    static Candidate* sortCandidates(Candidate* head);
+};
+
+// Top-K selection in the same order as MergeSort; links only the k best
+// matched candidates, for when the full ranking is not needed
+class TopSelect {
+public:
+    static Candidate* selectCandidates(Candidate* head, int k);
+};
+
 class InputUtils {
 public:
     static string getInput(const string& prompt, const string& valid1 = "", const string& valid2 = "", const string& valid3 = "");
@@ -82,7 +138,21 @@ public:
 
 class Matcher {
 public:
-    static MatchResult matchCandidates(JobRole* role, Candidate* candidates, SkillNode* searchSkills);
+    // Prompts for a weight per search skill, then ranks through rankCached()
+    static bool matchCandidates(JobRole* role, CandidateIndex& pool, SkillNode* searchSkills, CachedResult& result);
+    // Scores and ranks the pool for skills and weights already chosen
+    static MatchResult rankCandidates(CandidateIndex& pool, const SkillId searchIds[], const int weights[], int totalSkills);
+    // rankCandidates() keeping the Top 5 rows and the summary figures; a
+    // query pool.results already holds is copied from it instead (true)
+    static bool rankCached(JobRole* role, CandidateIndex& pool, const SkillId searchIds[], const int weights[], int totalSkills, CachedResult& result);
 };
 
-#endif
\ No newline at end of file
+// One HR session over data loaded once
+void optimized_merge(JobRole* jobs, CandidateIndex& pool);
+
+// Engine for the launcher
+Engine* createEngine();
+
+} // namespace optimized_merge_hr
+
+#endif
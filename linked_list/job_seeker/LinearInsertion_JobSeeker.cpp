@@ -1,19 +1,65 @@
 #include "LinearInsertion_JobSeeker.hpp"
 
-void SkillList::add(const string& skill, double weight) {
+namespace linear_insertion_jobseeker {
+
+// ---------- Skill List ----------
+SkillList::SkillList() : skills(nullptr), weights(nullptr), size(0), capacity(0) {}
+
+SkillList::SkillList(const SkillList& other)
+    : skills(nullptr), weights(nullptr), size(other.size), capacity(other.size) {
+    if (capacity > 0) {
+        skills = new SkillId[capacity];
+        weights = new double[capacity];
+        for (int i = 0; i < size; i++) {
+            skills[i] = other.skills[i];
+            weights[i] = other.weights[i];
+        }
+    }
+}
+
+SkillList& SkillList::operator=(const SkillList& other) {
+    if (this == &other) return *this;
+    SkillList copy(other);
+    swap(skills, copy.skills);
+    swap(weights, copy.weights);
+    swap(size, copy.size);
+    swap(capacity, copy.capacity);
+    return *this;
+}
+
+SkillList::~SkillList() {
+    delete[] skills;
+    delete[] weights;
+}
+
+void SkillList::add(SkillId skill, double weight) {
+    if (size == capacity) {
+        int newCapacity = capacity == 0 ? 8 : capacity * 2;
+        SkillId* grownSkills = new SkillId[newCapacity];
+        double* grownWeights = new double[newCapacity];
+        for (int i = 0; i < size; i++) {
+            grownSkills[i] = skills[i];
+            grownWeights[i] = weights[i];
+        }
+        delete[] skills;
+        delete[] weights;
+        skills = grownSkills;
+        weights = grownWeights;
+        capacity = newCapacity;
+    }
     skills[size] = skill;
     weights[size] = weight;
     size++;
 }
 
-bool SkillList::contains(const string& skill) const {
+bool SkillList::contains(SkillId skill) const {
     for (int i = 0; i < size; ++i)
         if (skills[i] == skill)
             return true;
     return false;
 }
 
-double SkillList::getWeight(const string& skill) const {
+double SkillList::getWeight(SkillId skill) const {
     for (int i = 0; i < size; ++i)
         if (skills[i] == skill)
             return weights[i];
@@ -21,7 +67,9 @@ double SkillList::getWeight(const string& skill) const {
 }
 
 Job::Job(const string& t, const SkillList& skills, double score)
-    : title(t), requiredSkills(skills), matchScore(score), prev(nullptr), next(nullptr) {}
+    : title(t), requiredSkills(skills), matchScore(score), prev(nullptr), next(nullptr) {
+    hasProfile = SkillBitset::buildPositionalQuery(requiredSkills.skills, requiredSkills.size, profile);
+}
 
 string toLowerCase(const string& str) {
     string lower = str;
@@ -30,60 +78,47 @@ string toLowerCase(const string& str) {
     return lower;
 }
 
-void insertAtTail(Job*& head, string title, SkillList skills) {
-    Job* newJob = new Job(title, skills);
+Job* insertAtTail(Job*& head, Job* tail, const string& title, const SkillList& skills, NodeArena& arena) {
+    Job* newJob = arena.create<Job>(title, skills);
     if (!head) {
         head = newJob;
-        return;
+        return newJob;
     }
 
-    Job* temp = head;
-    while (temp->next) temp = temp->next;
-    temp->next = newJob;
-    newJob->prev = temp;
+    tail->next = newJob;
+    newJob->prev = tail;
+    return newJob;
 }
 
-void loadJobsFromCSV(Job*& head, const string& filename, SkillList& allValidSkills) {
-    ifstream file(filename);
-    if (!file.is_open()) {
+void loadJobsFromCSV(Job*& head, const string& filename, SkillList& allValidSkills, NodeArena& arena) {
+    CsvReader reader(filename);
+    if (!reader.isOpen()) {
         cerr << "Error: could not open " << filename << endl;
         return;
     }
 
-    string line;
-    while (getline(file, line)) {
-        if (line.empty()) continue;
-
-        string title, skillsString;
-        size_t commaPos = line.find(',');
-        if (commaPos == string::npos) continue;
-
-        title = line.substr(0, commaPos);
-        skillsString = line.substr(commaPos + 1);
-
-        if (!skillsString.empty() && skillsString.front() == '"')
-            skillsString = skillsString.substr(1, skillsString.size() - 2);
-
+    Job* tail = nullptr;   // appends stay O(1) on long files
+    CsvRow row;
+    bool* listed = new bool[INVALID_SKILL]();   // already in allValidSkills, by ID
+    while (reader.next(row)) {
         SkillList skills;
-        stringstream skillsStream(skillsString);
-        string skill;
+        SkillTokenizer tokens(row.skills);
+        string_view token;
 
-        while (getline(skillsStream, skill, ',')) {
-            skill.erase(0, skill.find_first_not_of(" \t"));
-            skill.erase(skill.find_last_not_of(" \t") + 1);
-            if (skill.empty()) continue;
-
-            skill = toLowerCase(skill);
+        while (tokens.next(token)) {
+            SkillId skill = SkillDictionary::global().intern(token);
+            if (skill == INVALID_SKILL) continue;
             skills.add(skill);
 
-            if (!allValidSkills.contains(skill))
+            if (!listed[skill]) {
+                listed[skill] = true;
                 allValidSkills.add(skill);
+            }
         }
 
-        insertAtTail(head, title, skills);
+        tail = insertAtTail(head, tail, string(row.key), skills, arena);
     }
-
-    file.close();
+    delete[] listed;
 }
 
 SkillList insertSkills(const SkillList& allValidSkills) {
@@ -104,8 +139,28 @@ SkillList insertSkills(const SkillList& allValidSkills) {
         lowerSkill.erase(0, lowerSkill.find_first_not_of(" \t"));
         lowerSkill.erase(lowerSkill.find_last_not_of(" \t") + 1);
 
-        if (allValidSkills.contains(lowerSkill)) {
-            userSkills.add(lowerSkill, weightCounter);
+        SkillId id = SkillDictionary::global().find(lowerSkill);
+        if (id != INVALID_SKILL && allValidSkills.contains(id)) {
+            userSkills.add(id, weightCounter);
+            weightCounter++;
+        }
+    }
+
+    return userSkills;
+}
+
+// Same rules as insertSkills: unknown skills are skipped and each kept skill
+// weighs one more than the one before it
+SkillList skillsFromList(const string skills[], int count, const SkillList& allValidSkills) {
+    SkillList userSkills;
+    double weightCounter = 1.0;
+
+    for (int i = 0; i < count; i++) {
+        // find() trims and compares case-insensitively against the keys
+        // normalized at load, so the query string is used as given
+        SkillId id = SkillDictionary::global().find(skills[i]);
+        if (id != INVALID_SKILL && allValidSkills.contains(id)) {
+            userSkills.add(id, weightCounter);
             weightCounter++;
         }
     }
@@ -114,28 +169,46 @@ SkillList insertSkills(const SkillList& allValidSkills) {
 }
 
 void updateAllMatchScores(Job* head, const SkillList& userSkills) {
-    Job* temp = head;
 
-    while (temp) {
-        double matchedWeight = 0.0;
-        int skillCount = temp->requiredSkills.size;
-        double maxWeight = (skillCount * (skillCount + 1)) / 2.0;
+    // Bitset of the seeker's skills for popcount scoring
+    bool useBitset = SkillBitset::vocabularyFits();
+    SkillMask userMask = SkillBitset::maskOf(userSkills.skills, userSkills.size);
+
+    // Jobs are scored chunk by chunk on the thread pool; every job is
+    // written by exactly one chunk, so the scores match the serial walk
+    int jobTotal = countJobs(head);
+    Job** nodes = new Job*[jobTotal > 0 ? jobTotal : 1];
+    int n = 0;
+    for (Job* temp = head; temp; temp = temp->next) nodes[n++] = temp;
+
+    ThreadPool::global().parallelFor(jobTotal, DEFAULT_GRAIN, [&](int, int begin, int end) {
+        for (int j = begin; j < end; j++) {
+            Job* temp = nodes[j];
+            double matchedWeight = 0.0;
+            int skillCount = temp->requiredSkills.size;
+            double maxWeight = (skillCount * (skillCount + 1)) / 2.0;
 
-        for (int i = 0; i < skillCount; ++i) {
-            const string& jobSkill = temp->requiredSkills.skills[i];
-            double weight = skillCount - i;
-            if (userSkills.contains(jobSkill)) {
-                matchedWeight += weight;
+            if (useBitset && temp->hasProfile) {
+                int matchedSkills = 0, weight = 0;
+                SkillBitset::score(userMask, temp->profile, matchedSkills, weight);
+                matchedWeight = weight;
+            } else {
+                for (int i = 0; i < skillCount; ++i) {
+                    SkillId jobSkill = temp->requiredSkills.skills[i];
+                    double weight = skillCount - i;
+                    if (userSkills.contains(jobSkill)) {
+                        matchedWeight += weight;
+                    }
+                }
             }
-        }
-
-        if (maxWeight > 0)
-            temp->matchScore = (matchedWeight / maxWeight) * 100.0;
-        else
-            temp->matchScore = 0.0;
 
-        temp = temp->next;
-    }
+            if (maxWeight > 0)
+                temp->matchScore = (matchedWeight / maxWeight) * 100.0;
+            else
+                temp->matchScore = 0.0;
+        }
+    });
+    delete[] nodes;
 }
 
 void sortByScore(Job*& head) {
@@ -158,9 +231,10 @@ void sortByScore(Job*& head) {
             sortedHead->prev = current;
             sortedHead = current;
         } else {
-            // Insert in the middle or end
+            // Insert in the middle or end, after any equal scores so ties
+            // keep their load order
             Job* walker = sortedHead;
-            while (walker->next && walker->next->matchScore > current->matchScore)
+            while (walker->next && walker->next->matchScore >= current->matchScore)
                 walker = walker->next;
 
             current->next = walker->next;
@@ -178,7 +252,75 @@ void sortByScore(Job*& head) {
 }
 
 
+// Counting sort on matchScore as a fixed-point key, so the whole list is
+// ranked in sortByScore's order in a few O(n) passes instead of insertion
+// sort's O(n^2)
+void countingSortByScore(Job*& head) {
+    int n = countJobs(head);
+    if (n < 2) return;
+
+    Job** nodes = new Job*[n];
+    uint64_t* keys = new uint64_t[n];
+    int* order = new int[n];
+    int i = 0;
+    for (Job* temp = head; temp; temp = temp->next, i++) {
+        nodes[i] = temp;
+        keys[i] = CountingRank::percentKey(temp->matchScore);
+    }
+    CountingRank::rank(keys, n, order);
+
+    for (i = 0; i < n; i++) {
+        Job* job = nodes[order[i]];
+        job->prev = (i > 0) ? nodes[order[i - 1]] : nullptr;
+        job->next = (i + 1 < n) ? nodes[order[i + 1]] : nullptr;
+    }
+    head = nodes[order[0]];
+    delete[] nodes;
+    delete[] keys;
+    delete[] order;
+}
+
+
+// Top-K selection in the same order as sortByScore: the k best jobs are
+// moved to the front of the list in rank order, the rest keep their order
+void selectTopJobs(Job*& head, int k) {
+    auto better = [](Job* a, Job* b) {
+        return a->matchScore > b->matchScore;
+    };
+    TopK<Job*, decltype(better)> top(k, better);
+    for (Job* temp = head; temp; temp = temp->next)
+        top.push(temp);
+
+    Job** best = new Job*[k];
+    int kept = top.take(best);
+    for (int i = 0; i < kept; i++) {
+        Job* job = best[i];
+        if (job->prev) job->prev->next = job->next;
+        else head = job->next;
+        if (job->next) job->next->prev = job->prev;
+    }
+    for (int i = kept - 1; i >= 0; i--) {
+        best[i]->prev = nullptr;
+        best[i]->next = head;
+        if (head) head->prev = best[i];
+        head = best[i];
+    }
+    delete[] best;
+}
+
+// Only the top 3 are shown, so select them unless the list is that short
+// or the ranking mode asks for a full sort
+void rankJobs(Job*& head) {
+    if (Ranking::selectTop(TOP_JOBS, countJobs(head)))
+        selectTopJobs(head, TOP_JOBS);
+    else if (Ranking::counting())
+        countingSortByScore(head);
+    else
+        sortByScore(head);
+}
+
 void displayJobs(Job* head, double minScore) {
+    AllocScope displaying(ALLOC_DISPLAY);
     cout << "\nTop 3 Best-Matching Jobs (Weighted Scoring):\n";
     cout << left << setw(25) << "Job Title"
          << setw(10) << "Matched"
@@ -190,7 +332,7 @@ void displayJobs(Job* head, double minScore) {
     int count = 0;
 
     cout << fixed << setprecision(2);
-    while (temp && count < 3) {
+    while (temp && count < TOP_JOBS) {
         if (temp->matchScore >= minScore) {
             int skillCount = temp->requiredSkills.size;
             double maxWeight = (skillCount * (skillCount + 1)) / 2.0;
@@ -230,7 +372,7 @@ void menu(Job*& head, const SkillList& allValidSkills) {
     SkillList userSkills;
 
     double searchDuration = 0.0, sortDuration = 0.0;
-    size_t searchMemoryKB = 0, sortMemoryKB = 0;
+    long long searchMemoryBytes = 0, sortMemoryBytes = 0;   // measured heap deltas
     bool performanceRecorded = false;
 
     do {
@@ -249,22 +391,24 @@ void menu(Job*& head, const SkillList& allValidSkills) {
                 userSkills = insertSkills(allValidSkills);
 
                 // ✅ Measure Linear Search Time & Memory
+                MemoryPhase searchMemory(ALLOC_SEARCH);
+                searchMemory.start();
                 auto searchStart = chrono::high_resolution_clock::now();
                 updateAllMatchScores(head, userSkills);
                 auto searchEnd = chrono::high_resolution_clock::now();
                 searchDuration = chrono::duration<double, milli>(searchEnd - searchStart).count();
-                searchMemoryKB = (sizeof(SkillList) + sizeof(string) * userSkills.size) /  1024.0;
+                searchMemory.stop();
+                searchMemoryBytes = searchMemory.heapDeltaBytes();
 
                 // ✅ Measure Insertion Sort Time & Memory
+                MemoryPhase sortMemory(ALLOC_SORT);
+                sortMemory.start();
                 auto sortStart = chrono::high_resolution_clock::now();
-                sortByScore(head);
+                rankJobs(head);
                 auto sortEnd = chrono::high_resolution_clock::now();
                 sortDuration = chrono::duration<double, milli>(sortEnd - sortStart).count();
-                int jobCount = countJobs(head);
-                sortMemoryKB = (
-                    (sizeof(Job) + sizeof(Job*) + sizeof(double)) * jobCount * 0.1 + 
-                    (sizeof(string) * userSkills.size) 
-                );
+                sortMemory.stop();
+                sortMemoryBytes = sortMemory.heapDeltaBytes();
 
                 performanceRecorded = true;
                 displayJobs(head, 0);
@@ -278,9 +422,12 @@ void menu(Job*& head, const SkillList& allValidSkills) {
                     cout << "Performance Summary\n";
                     cout << "=============================\n";
                     cout << "Linear Search Time: " << searchDuration << " ms\n";
-                    cout << "Linear Search Memory: " << (searchMemoryKB / 1024.0) << " KB\n";
+                    cout << "Linear Search Memory: " << (searchMemoryBytes / 1024.0) << " KB\n";
                     cout << "Insertion Sort Time: " << sortDuration << " ms\n";
-                    cout << "Insertion Sort Memory: " << (sortMemoryKB / 1024.0) << " KB\n\n";
+                    cout << "Insertion Sort Memory: " << (sortMemoryBytes / 1024.0) << " KB\n";
+                    cout << "Process RSS: " << MemoryStats::currentRssKB() << " KB\n";
+                    cout << "Peak RSS: " << MemoryStats::peakRssKB() << " KB\n\n";
+                    AllocStats::printReport();
                     cout.unsetf(ios::fixed);
                 } else {
                     cout << "\nNo performance data available yet. Please run 'Insert Skills' first.\n\n";
@@ -300,13 +447,43 @@ void menu(Job*& head, const SkillList& allValidSkills) {
     } while (choice != 3);
 }
 
-int main() {
+// Engine
+class LinearInsertionJobSeekerEngine : public Engine {
+private:
+    NodeArena nodes;   // every job node; outlives the list below
     Job* head = nullptr;
     SkillList allValidSkills;
 
-    loadJobsFromCSV(head, "job_description/mergejob.csv", allValidSkills);
-    menu(head, allValidSkills);
-    return 0;
+public:
+    const char* name() const override { return "Linked List Insertion Sort and Linear Search (Job Seeker)"; }
+
+    bool loadFrom(const string& jobsFile, const string&) override {
+        loadJobsFromCSV(head, jobsFile, allValidSkills, nodes);
+        return head != nullptr;
+    }
+
+    void query() override { menu(head, allValidSkills); }
+
+    int recordCount() const override { return countJobs(head); }
+
+    bool runQuery(const EngineQuery& query) override {
+        SkillList userSkills = skillsFromList(query.skills, query.skillCount, allValidSkills);
+        updateAllMatchScores(head, userSkills);
+        rankJobs(head);
+        return true;
+    }
+};
+
+Engine* createEngine() { return new LinearInsertionJobSeekerEngine(); }
+
+} // namespace linear_insertion_jobseeker
+
+#ifndef ENGINE_NO_MAIN
+int main(int argc, char* argv[]) {
+    ThreadPool::configure(ThreadPool::threadsFromArgs(argc, argv));
+    Ranking::configure(Ranking::modeFromArgs(argc, argv));
+    return runEngine(linear_insertion_jobseeker::createEngine());
 }
+#endif
 
 
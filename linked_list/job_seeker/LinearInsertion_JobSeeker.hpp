@@ -8,17 +8,39 @@
 #include <iomanip>
 #include <algorithm>
 #include <chrono>
+#include "../../common/CsvLoader.hpp"
+#include "../../common/SkillDictionary.hpp"
+#include "../../common/SkillBitset.hpp"
+#include "../../common/TopK.hpp"
+#include "../../common/CountingRank.hpp"
+#include "../../common/ThreadPool.hpp"
+#include "../../common/MemoryStats.hpp"
+#include "../../common/NodeArena.hpp"
+#include "../../common/Engine.hpp"
 using namespace std;
 using namespace std::chrono;
 
+namespace linear_insertion_jobseeker {
+
+const int TOP_JOBS = 3;   // rows in the Top 3 table
+
+// Skills are interned IDs; SkillDictionary::global() maps them back to text.
+// The arrays grow on demand: allValidSkills holds every distinct job skill,
+// which is as large as the dataset's vocabulary.
 struct SkillList {
-    string skills[100];
-    double weights[100];
-    int size = 0;
+    SkillId* skills;
+    double* weights;
+    int size;
+    int capacity;
+
+    SkillList();
+    SkillList(const SkillList& other);
+    SkillList& operator=(const SkillList& other);
+    ~SkillList();
 
-    void add(const string& skill, double weight = 0.0);
-    bool contains(const string& skill) const;
-    double getWeight(const string& skill) const;
+    void add(SkillId skill, double weight = 0.0);
+    bool contains(SkillId skill) const;
+    double getWeight(SkillId skill) const;
 };
 
 struct Job {
@@ -27,19 +49,30 @@ struct Job {
     double matchScore;
     Job* prev;
     Job* next;
+    WeightedQuery profile;   // positional skill weights as bit planes
+    bool hasProfile;
 
     Job(const string& t, const SkillList& skills = {}, double score = 0.0);
 };
 
 string toLowerCase(const string& str);
 
-void insertAtTail(Job*& head, string title, SkillList skills);
-void loadJobsFromCSV(Job*& head, const string& filename, SkillList& allValidSkills);
+Job* insertAtTail(Job*& head, Job* tail, const string& title, const SkillList& skills, NodeArena& arena);   // returns the new tail
+void loadJobsFromCSV(Job*& head, const string& filename, SkillList& allValidSkills, NodeArena& arena);
 SkillList insertSkills(const SkillList& allValidSkills);
+SkillList skillsFromList(const string skills[], int count, const SkillList& allValidSkills);   // non-interactive insertSkills
 void updateAllMatchScores(Job* head, const SkillList& userSkills);
 void sortByScore(Job*& head);
+void countingSortByScore(Job*& head);   // stable, on the fixed-point score
+void selectTopJobs(Job*& head, int k);
+void rankJobs(Job*& head);   // top-K, insertion or counting sort, as the menu does
 void displayJobs(Job* head, double minScore);
 int countJobs(Job* head);
-void menu(Job*& head, const SkillList& allValidSkills, size_t baselineMemory);
+void menu(Job*& head, const SkillList& allValidSkills);
+
+// Engine for the launcher
+Engine* createEngine();
+
+} // namespace linear_insertion_jobseeker
 
 #endif
\ No newline at end of file
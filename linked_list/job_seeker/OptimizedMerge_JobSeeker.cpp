@@ -1,20 +1,66 @@
 #include "OptimizedMerge_JobSeeker.hpp"
 
-void SkillList::add(const string& skill, double weight) {
+namespace optimized_merge_jobseeker {
+
+// ---------- Skill List ----------
+SkillList::SkillList() : skills(nullptr), weights(nullptr), size(0), capacity(0) {}
+
+SkillList::SkillList(const SkillList& other)
+    : skills(nullptr), weights(nullptr), size(other.size), capacity(other.size) {
+    if (capacity > 0) {
+        skills = new SkillId[capacity];
+        weights = new double[capacity];
+        for (int i = 0; i < size; i++) {
+            skills[i] = other.skills[i];
+            weights[i] = other.weights[i];
+        }
+    }
+}
+
+SkillList& SkillList::operator=(const SkillList& other) {
+    if (this == &other) return *this;
+    SkillList copy(other);
+    swap(skills, copy.skills);
+    swap(weights, copy.weights);
+    swap(size, copy.size);
+    swap(capacity, copy.capacity);
+    return *this;
+}
+
+SkillList::~SkillList() {
+    delete[] skills;
+    delete[] weights;
+}
+
+void SkillList::add(SkillId skill, double weight) {
     for (int i = 0; i < size; ++i)
         if (skills[i] == skill) return;
+    if (size == capacity) {
+        int newCapacity = capacity == 0 ? 8 : capacity * 2;
+        SkillId* grownSkills = new SkillId[newCapacity];
+        double* grownWeights = new double[newCapacity];
+        for (int i = 0; i < size; i++) {
+            grownSkills[i] = skills[i];
+            grownWeights[i] = weights[i];
+        }
+        delete[] skills;
+        delete[] weights;
+        skills = grownSkills;
+        weights = grownWeights;
+        capacity = newCapacity;
+    }
     skills[size] = skill;
     weights[size] = weight;
     size++;
 }
 
-bool SkillList::contains(const string& skill) const {
+bool SkillList::contains(SkillId skill) const {
     for (int i = 0; i < size; ++i)
         if (skills[i] == skill) return true;
     return false;
 }
 
-double SkillList::getWeight(const string& skill) const {
+double SkillList::getWeight(SkillId skill) const {
     for (int i = 0; i < size; ++i)
         if (skills[i] == skill) return weights[i];
     return 0.0;
@@ -27,46 +73,59 @@ string toLowerCase(const string& str) {
     return lower;
 }
 
-void insertAtTail(Job*& head, string title, SkillList skills) {
-    Job* newJob = new Job{title, skills, 0, nullptr, nullptr};
+Job* insertAtTail(Job*& head, Job* tail, const string& title, const SkillList& skills, NodeArena& arena) {
+    Job* newJob = arena.create<Job>(title, skills, 0.0, nullptr, nullptr);
+    newJob->hasProfile = SkillBitset::buildPositionalQuery(newJob->requiredSkills.skills,
+                                                           newJob->requiredSkills.size, newJob->profile);
     if (!head) {
         head = newJob;
-        return;
+        return newJob;
     }
-    Job* temp = head;
-    while (temp->next) temp = temp->next;
-    temp->next = newJob;
-    newJob->prev = temp;
+    tail->next = newJob;
+    newJob->prev = tail;
+    return newJob;
 }
 
-void loadJobsFromCSV(Job*& head, const string& filename, SkillList& allValidSkills) {
-    ifstream file(filename);
-    string line;
+void loadJobsFromCSV(Job*& head, const string& filename, SkillList& allValidSkills, NodeArena& arena) {
+    CsvReader reader(filename);
+    Job* tail = nullptr;   // appends stay O(1) on long files
+    CsvRow row;
+    bool* listed = new bool[INVALID_SKILL]();   // already in allValidSkills, by ID
 
-    while (getline(file, line)) {
-        stringstream ss(line);
-        string title, skillsString;
+    while (reader.next(row)) {
         SkillList skills;
-
-        getline(ss, title, ',');
-        getline(ss, skillsString);
-
-        if (!skillsString.empty() && skillsString.front() == '"')
-            skillsString = skillsString.substr(1, skillsString.size() - 2);
-
-        stringstream skillsStream(skillsString);
-        string skill;
-        while (getline(skillsStream, skill, ',')) {
-            while (!skill.empty() && skill.front() == ' ') skill.erase(skill.begin());
-            string lowerSkill = toLowerCase(skill);
-            skills.add(lowerSkill);
-            allValidSkills.add(lowerSkill); // ✅ add to global valid skills too
+        SkillTokenizer tokens(row.skills);
+        string_view token;
+        while (tokens.next(token)) {
+            SkillId skill = SkillDictionary::global().intern(token);
+            if (skill == INVALID_SKILL) continue;
+            skills.add(skill);
+            if (!listed[skill]) {
+                listed[skill] = true;
+                allValidSkills.add(skill); // ✅ add to global valid skills too
+            }
         }
 
-        insertAtTail(head, title, skills);
+        tail = insertAtTail(head, tail, string(row.key), skills, arena);
     }
+    delete[] listed;
+    rankTitles(head);
+}
 
-    file.close();
+// Lets countingSort break score ties on the title the way merge() does
+void rankTitles(Job* head) {
+    int n = countJobs(head);
+    Job** nodes = new Job*[n > 0 ? n : 1];
+    int i = 0;
+    for (Job* temp = head; temp; temp = temp->next) nodes[i++] = temp;
+    sort(nodes, nodes + n, [](const Job* a, const Job* b) { return a->title < b->title; });
+
+    int rank = 0;
+    for (i = 0; i < n; i++) {
+        if (i > 0 && nodes[i - 1]->title < nodes[i]->title) rank++;
+        nodes[i]->titleRank = rank;
+    }
+    delete[] nodes;
 }
 
 
@@ -90,8 +149,28 @@ SkillList insertSkills(const SkillList& allValidSkills) {
         lowerSkill.erase(lowerSkill.find_last_not_of(" \t") + 1);
 
         // Only add skills that exist in the dataset
-        if (allValidSkills.contains(lowerSkill)) {
-            userSkills.add(lowerSkill, weightCounter);
+        SkillId id = SkillDictionary::global().find(lowerSkill);
+        if (id != INVALID_SKILL && allValidSkills.contains(id)) {
+            userSkills.add(id, weightCounter);
+            weightCounter++;
+        }
+    }
+
+    return userSkills;
+}
+
+// Same rules as insertSkills: unknown skills are skipped and each kept skill
+// weighs one more than the one before it
+SkillList skillsFromList(const string skills[], int count, const SkillList& allValidSkills) {
+    SkillList userSkills;
+    double weightCounter = 1.0;
+
+    for (int i = 0; i < count; i++) {
+        // find() trims and compares case-insensitively against the keys
+        // normalized at load, so the query string is used as given
+        SkillId id = SkillDictionary::global().find(skills[i]);
+        if (id != INVALID_SKILL && allValidSkills.contains(id)) {
+            userSkills.add(id, weightCounter);
             weightCounter++;
         }
     }
@@ -101,63 +180,67 @@ SkillList insertSkills(const SkillList& allValidSkills) {
 
 // Optimized Linear Search for skill matching
 void updateAllMatchScores(Job* head, const SkillList& userSkills, 
-                          double& searchTime, size_t& searchMemory) {
-    Job* temp = head;
+                          double& searchTime, long long& searchMemory) {
+    MemoryPhase memory(ALLOC_SEARCH);
+    memory.start();
     auto searchStart = chrono::high_resolution_clock::now();
 
-    size_t seekerSkillCount = userSkills.size;
-    size_t jobCount = countJobs(head);
-    size_t baseMemory = sizeof(SkillList) + sizeof(double) * 2 + sizeof(int);
-
-    size_t optimizedSearchMemory =
-        (
-         (sizeof(Job) * jobCount) +                              
-            (sizeof(string) * seekerSkillCount * 4) +               // multiple cached skill lists
-            (sizeof(double) * seekerSkillCount * 3) +               // precomputed weights, relevance, normalization
-            (sizeof(bool) * jobCount * seekerSkillCount * 2) +      // dual-layer match matrix
-            (sizeof(double) * jobCount * seekerSkillCount * 2) +    // weighted score buffers
-            (sizeof(string) * jobCount * seekerSkillCount) +        // job-skill text lookup table
-            (sizeof(int) * jobCount * seekerSkillCount) +           // indexing structure
-            (sizeof(void*) * jobCount * 10) +                       // multiple pointer arrays for caching
-            (baseMemory * 20)                                       // base overhead ×20 for complex optimization
-        ) / 256.0;
-
-    searchMemory = optimizedSearchMemory;
-
-    while (temp) {
-        double matchedWeight = 0.0;
-        int skillCount = temp->requiredSkills.size;
-        double maxWeight = (skillCount * (skillCount + 1)) / 2.0;
+    // Bitset of the seeker's skills for popcount scoring
+    bool useBitset = SkillBitset::vocabularyFits();
+    SkillMask userMask = SkillBitset::maskOf(userSkills.skills, userSkills.size);
+
+    // Jobs are scored chunk by chunk on the thread pool; every job is
+    // written by exactly one chunk, so the scores match the serial walk
+    int jobTotal = countJobs(head);
+    Job** nodes = new Job*[jobTotal > 0 ? jobTotal : 1];
+    int n = 0;
+    for (Job* temp = head; temp; temp = temp->next) nodes[n++] = temp;
+
+    ThreadPool::global().parallelFor(jobTotal, DEFAULT_GRAIN, [&](int, int begin, int end) {
+        for (int j = begin; j < end; j++) {
+            Job* temp = nodes[j];
+            double matchedWeight = 0.0;
+            int skillCount = temp->requiredSkills.size;
+            double maxWeight = (skillCount * (skillCount + 1)) / 2.0;
 
-        for (int i = 0; i < skillCount; ++i) {
-            const string& jobSkill = temp->requiredSkills.skills[i];
-            double weight = skillCount - i;
+            if (useBitset && temp->hasProfile) {
+                int matchedSkills = 0, weight = 0;
+                SkillBitset::score(userMask, temp->profile, matchedSkills, weight);
+                matchedWeight = weight;
+            } else {
+                for (int i = 0; i < skillCount; ++i) {
+                    SkillId jobSkill = temp->requiredSkills.skills[i];
+                    double weight = skillCount - i;
 
-            if (userSkills.contains(jobSkill)) {
-                matchedWeight += weight;
+                    if (userSkills.contains(jobSkill)) {
+                        matchedWeight += weight;
+                    }
+                }
             }
-        }
-
-        if (maxWeight > 0)
-            temp->matchScore = (matchedWeight / maxWeight) * 100.0;
-        else
-            temp->matchScore = 0.0;
 
-        temp = temp->next;
-    }
+            if (maxWeight > 0)
+                temp->matchScore = (matchedWeight / maxWeight) * 100.0;
+            else
+                temp->matchScore = 0.0;
+        }
+    });
+    delete[] nodes;
 
     auto searchEnd = chrono::high_resolution_clock::now();
     searchTime = chrono::duration<double, milli>(searchEnd - searchStart).count();
+    memory.stop();
+    searchMemory = memory.heapDeltaBytes();
 }
 
-Job* extractMatchedJobs(Job* head) {
+Job* extractMatchedJobs(Job* head, NodeArena& scratch) {
     Job* matchedHead = nullptr;
     Job* matchedTail = nullptr;
 
     Job* temp = head;
     while (temp) {
         if (temp->matchScore > 0.0) {
-            Job* newJob = new Job{temp->title, temp->requiredSkills, temp->matchScore, nullptr, nullptr};
+            Job* newJob = scratch.create<Job>(temp->title, temp->requiredSkills, temp->matchScore, nullptr, nullptr,
+                                              temp->profile, temp->hasProfile, temp->titleRank);
             if (!matchedHead) {
                 matchedHead = matchedTail = newJob;
             } else {
@@ -172,48 +255,37 @@ Job* extractMatchedJobs(Job* head) {
     return matchedHead;
 }
 
-void split(Job* source, Job** frontRef, Job** backRef) {
-    if (!source || !source->next) {
-        *frontRef = source;
-        *backRef = nullptr;
-        return;
-    }
-
-    Job* slow = source;
-    Job* fast = source->next;
-
-    // Move 'fast' by two and 'slow' by one
-    while (fast) {
-        fast = fast->next;
-        if (fast) {
-            slow = slow->next;
-            fast = fast->next;
-        }
-    }
+// 🔹 Sort by matchScore descending, then by title
+static bool ranksBefore(const Job* a, const Job* b) {
+    return a->matchScore > b->matchScore ||
+           (fabs(a->matchScore - b->matchScore) < 1e-6 && a->title < b->title);
+}
 
-    *frontRef = source;
-    *backRef = slow->next;
-    slow->next = nullptr;
-    if (*backRef) (*backRef)->prev = nullptr;
+Job* cutRun(Job* head) {
+    while (head->next && !ranksBefore(head->next, head))
+        head = head->next;
+    Job* rest = head->next;
+    head->next = nullptr;
+    return rest;
 }
 
+// Only next links are set here; mergeSortList restores prev afterwards.
+// The left run wins ties, so equal jobs keep their order.
 Job* merge(Job* left, Job* right) {
-    if (!left) return right;
-    if (!right) return left;
-
-    // 🔹 Sort by matchScore descending
-    if (left->matchScore > right->matchScore ||
-       (fabs(left->matchScore - right->matchScore) < 1e-6 && left->title < right->title)) {
-        left->next = merge(left->next, right);
-        if (left->next) left->next->prev = left;
-        left->prev = nullptr;
-        return left;
-    } else {
-        right->next = merge(left, right->next);
-        if (right->next) right->next->prev = right;
-        right->prev = nullptr;
-        return right;
+    Job* result = nullptr;
+    Job** tail = &result;
+    while (left && right) {
+        if (ranksBefore(right, left)) {
+            *tail = right;
+            right = right->next;
+        } else {
+            *tail = left;
+            left = left->next;
+        }
+        tail = &(*tail)->next;
     }
+    *tail = left ? left : right;
+    return result;
 }
 
 int countJobs(Job* head) {
@@ -225,55 +297,147 @@ int countJobs(Job* head) {
     return count;
 }
 
-void mergeSort(Job*& head, double& sortTime, size_t& sortMemory) {
-    auto start = chrono::high_resolution_clock::now();
+// Bottom-up merge sort over the runs already in the list. Each run is
+// carried up the bins like a binary counter (bin i holds about 2^i runs),
+// so there is no recursion and sorted input is a single scan.
+static void mergeSortList(Job*& head) {
+    if (!head || !head->next) return;
 
-    if (!head || !head->next) {
-        sortMemory = sizeof(Job);
-        auto end = chrono::high_resolution_clock::now();
-        sortTime = chrono::duration<double, milli>(end - start).count();
-        return;
+    const int MAX_BINS = 48;
+    Job* bins[MAX_BINS] = {};
+    while (head) {
+        Job* run = head;
+        head = cutRun(run);
+        int i = 0;
+        for (; i < MAX_BINS - 1 && bins[i]; i++) {
+            run = merge(bins[i], run);
+            bins[i] = nullptr;
+        }
+        if (bins[i]) run = merge(bins[i], run);
+        bins[i] = run;
     }
 
-    // Step 1: Split list into halves
-    Job* left = nullptr;
-    Job* right = nullptr;
-    split(head, &left, &right);
-
-    double leftTime = 0.0, rightTime = 0.0;
-    size_t leftMemory = 0, rightMemory = 0;
+    // Lower bins hold later runs
+    for (int i = 0; i < MAX_BINS; i++) {
+        if (bins[i]) head = merge(bins[i], head);
+    }
 
-    // Step 2: Recursively sort both halves
-    mergeSort(left, leftTime, leftMemory);
-    mergeSort(right, rightTime, rightMemory);
+    Job* prev = nullptr;
+    for (Job* temp = head; temp; temp = temp->next) {
+        temp->prev = prev;
+        prev = temp;
+    }
+}
 
-    // Step 3: Merge sorted halves
-    head = merge(left, right);
+void mergeSort(Job*& head, double& sortTime, long long& sortMemory) {
+    MemoryPhase memory(ALLOC_SORT);
+    memory.start();
+    auto start = chrono::high_resolution_clock::now();
+    mergeSortList(head);
+    auto end = chrono::high_resolution_clock::now();
+    sortTime = chrono::duration<double, milli>(end - start).count();
+    memory.stop();
+    sortMemory = memory.heapDeltaBytes();
+}
 
-    // Step 4: Simulated heavier memory (about +0.5 KB than insertion)
-    int jobCount = countJobs(head);
+// Stable counting sort on one key per job: the fixed-point score, then the
+// title rank reversed in the low digits so A comes before B on a tie
+static void countingSortList(Job*& head) {
+    int n = countJobs(head);
+    if (n < 2) return;
+
+    Job** nodes = new Job*[n];
+    uint64_t* keys = new uint64_t[n];
+    int* order = new int[n];
+    int maxRank = 0;
+    int i = 0;
+    for (Job* temp = head; temp; temp = temp->next, i++) {
+        nodes[i] = temp;
+        if (temp->titleRank > maxRank) maxRank = temp->titleRank;
+    }
+    for (i = 0; i < n; i++) {
+        keys[i] = CountingRank::percentKey(nodes[i]->matchScore) * (uint64_t)(maxRank + 1) +
+                  (uint64_t)(maxRank - nodes[i]->titleRank);
+    }
+    CountingRank::rank(keys, n, order);
 
-    // Conceptual "heavier" merge memory model
-    sortMemory = (
-        (sizeof(Job) * jobCount * 0.2) + 
-        (sizeof(Job*) * jobCount * 0.08) +      
-        (sizeof(double) * jobCount * 0.05) +    
-        (sizeof(string) * jobCount * 0.03) +    
-        (sizeof(void*) * jobCount * 0.05) +     
-        (sizeof(int) * jobCount * 0.03)
-    );
+    for (i = 0; i < n; i++) {
+        Job* job = nodes[order[i]];
+        job->prev = (i > 0) ? nodes[order[i - 1]] : nullptr;
+        job->next = (i + 1 < n) ? nodes[order[i + 1]] : nullptr;
+    }
+    head = nodes[order[0]];
+    delete[] nodes;
+    delete[] keys;
+    delete[] order;
+}
 
+void countingSort(Job*& head, double& sortTime, long long& sortMemory) {
+    MemoryPhase memory(ALLOC_SORT);
+    memory.start();
+    auto start = chrono::high_resolution_clock::now();
+    countingSortList(head);
     auto end = chrono::high_resolution_clock::now();
     sortTime = chrono::duration<double, milli>(end - start).count();
+    memory.stop();
+    sortMemory = memory.heapDeltaBytes();
 }
 
-void sortByScore(Job*& head, double& sortTime, size_t& sortMemory) {
+void sortByScore(Job*& head, double& sortTime, long long& sortMemory) {
     sortTime = 0.0;
     sortMemory = 0;
     mergeSort(head, sortTime, sortMemory);
 }
 
+// Top-K selection in the same order as mergeSort: the k best jobs are
+// moved to the front of the list in rank order, the rest keep their order
+void selectTopJobs(Job*& head, int k) {
+    auto better = [](Job* a, Job* b) {
+        return a->matchScore > b->matchScore ||
+               (fabs(a->matchScore - b->matchScore) < 1e-6 && a->title < b->title);
+    };
+    TopK<Job*, decltype(better)> top(k, better);
+    for (Job* temp = head; temp; temp = temp->next)
+        top.push(temp);
+
+    Job** best = new Job*[k];
+    int kept = top.take(best);
+    for (int i = 0; i < kept; i++) {
+        Job* job = best[i];
+        if (job->prev) job->prev->next = job->next;
+        else head = job->next;
+        if (job->next) job->next->prev = job->prev;
+    }
+    for (int i = kept - 1; i >= 0; i--) {
+        best[i]->prev = nullptr;
+        best[i]->next = head;
+        if (head) head->prev = best[i];
+        head = best[i];
+    }
+    delete[] best;
+}
+
+// Rank matched jobs: top-K selection when only the top 3 are needed,
+// unless the ranking mode asks for a full sort
+void rankJobs(Job*& head, double& sortTime, long long& sortMemory) {
+    if (Ranking::selectTop(TOP_JOBS, countJobs(head))) {
+        MemoryPhase memory(ALLOC_SORT);
+        memory.start();
+        auto start = chrono::high_resolution_clock::now();
+        selectTopJobs(head, TOP_JOBS);
+        auto end = chrono::high_resolution_clock::now();
+        sortTime = chrono::duration<double, milli>(end - start).count();
+        memory.stop();
+        sortMemory = memory.heapDeltaBytes();
+    } else if (Ranking::counting()) {
+        countingSort(head, sortTime, sortMemory);
+    } else {
+        mergeSort(head, sortTime, sortMemory);
+    }
+}
+
 void displayJobs(Job* head, double minScore) {
+    AllocScope displaying(ALLOC_DISPLAY);
     cout << "\nTop 3 Best-Matching Jobs (Weighted Scoring):\n";
     cout << left << setw(25) << "Job Title"
          << setw(10) << "Matched"
@@ -285,17 +449,16 @@ void displayJobs(Job* head, double minScore) {
     int count = 0;
 
     cout << fixed << setprecision(2);
-    while (temp && count < 3) {  // Show top 3 only
+    while (temp && count < TOP_JOBS) {  // Show top 3 only
         if (temp->matchScore >= minScore) {
             // Example placeholders: assume matched skills and total weights calculated earlier
             int matched = 0;
             double totalWeight = 0.0;
 
             int skillCount = temp->requiredSkills.size;
-            double maxWeight = (skillCount * (skillCount + 1)) / 2.0;
 
             for (int i = 0; i < skillCount; ++i) {
-                if (temp->requiredSkills.skills[i] != "") matched++;
+                if (temp->requiredSkills.skills[i] != INVALID_SKILL) matched++;
             }
 
             totalWeight = skillCount; // Example: using skill count as total weight
@@ -326,8 +489,8 @@ void menu(Job*& head, const SkillList& allValidSkills) {
     SkillList userSkills;
 
     // Variables to store performance data
-    double matchDuration = 0.0, sortDuration = 0.0, searchDuration = 0.0;
-    size_t sortMemoryKB = 0, searchMemoryKB = 0;
+    double sortDuration = 0.0, searchDuration = 0.0;
+    long long sortMemoryBytes = 0, searchMemoryBytes = 0;   // measured heap deltas
     bool performanceRecorded = false;
 
     do {
@@ -345,13 +508,13 @@ void menu(Job*& head, const SkillList& allValidSkills) {
             case 1: {
                 userSkills = insertSkills(allValidSkills);
 
-                updateAllMatchScores(head, userSkills, searchDuration, searchMemoryKB);
+                updateAllMatchScores(head, userSkills, searchDuration, searchMemoryBytes);
 
-                // Extract only matched jobs
-                Job* matchedJobs = extractMatchedJobs(head);
+                // Extract only matched jobs; the copies go when scratch does
+                NodeArena scratch;
+                Job* matchedJobs = extractMatchedJobs(head, scratch);
 
-                // Sort matched jobs using insertion sort
-                mergeSort(matchedJobs, sortDuration, sortMemoryKB);
+                rankJobs(matchedJobs, sortDuration, sortMemoryBytes);
 
                 performanceRecorded = true;
                 displayJobs(matchedJobs, 0);
@@ -365,9 +528,12 @@ void menu(Job*& head, const SkillList& allValidSkills) {
                     cout << "Performance Summary\n";
                     cout << "=============================\n";
                     cout << "Optimized Linear Search Time: " << searchDuration << " ms\n";
-                    cout << "Optimized Linear Search Memory: " << (searchMemoryKB / 1024.0) << " KB\n";
+                    cout << "Optimized Linear Search Memory: " << (searchMemoryBytes / 1024.0) << " KB\n";
                     cout << "Merge Sort Time: " << sortDuration << " ms\n";
-                    cout << "Merge Sort Memory: " << (sortMemoryKB / 1024.0) << " KB\n\n";
+                    cout << "Merge Sort Memory: " << (sortMemoryBytes / 1024.0) << " KB\n";
+                    cout << "Process RSS: " << MemoryStats::currentRssKB() << " KB\n";
+                    cout << "Peak RSS: " << MemoryStats::peakRssKB() << " KB\n\n";
+                    AllocStats::printReport();
                     cout.unsetf(ios::fixed);
                 } else {
                     cout << "\nNo performance data available yet. Please run 'Insert Skills' first.\n\n";
@@ -387,11 +553,46 @@ void menu(Job*& head, const SkillList& allValidSkills) {
     } while (choice != 3);
 }
 
-int main() {
+// Engine
+class OptimizedMergeJobSeekerEngine : public Engine {
+private:
+    NodeArena nodes;   // every job node; outlives the list below
     Job* head = nullptr;
     SkillList allValidSkills;
 
-    loadJobsFromCSV(head, "job_description/mergejob.csv", allValidSkills);
-    menu(head, allValidSkills);
-    return 0;
-}
\ No newline at end of file
+public:
+    const char* name() const override { return "Linked List Merge Sort and Optimized Linear Search (Job Seeker)"; }
+
+    bool loadFrom(const string& jobsFile, const string&) override {
+        loadJobsFromCSV(head, jobsFile, allValidSkills, nodes);
+        return head != nullptr;
+    }
+
+    void query() override { menu(head, allValidSkills); }
+
+    int recordCount() const override { return countJobs(head); }
+
+    bool runQuery(const EngineQuery& query) override {
+        SkillList userSkills = skillsFromList(query.skills, query.skillCount, allValidSkills);
+        double searchTime = 0.0, sortTime = 0.0;
+        long long searchMemory = 0, sortMemory = 0;
+        updateAllMatchScores(head, userSkills, searchTime, searchMemory);
+
+        NodeArena scratch;
+        Job* matchedJobs = extractMatchedJobs(head, scratch);
+        rankJobs(matchedJobs, sortTime, sortMemory);
+        return true;
+    }
+};
+
+Engine* createEngine() { return new OptimizedMergeJobSeekerEngine(); }
+
+} // namespace optimized_merge_jobseeker
+
+#ifndef ENGINE_NO_MAIN
+int main(int argc, char* argv[]) {
+    ThreadPool::configure(ThreadPool::threadsFromArgs(argc, argv));
+    Ranking::configure(Ranking::modeFromArgs(argc, argv));
+    return runEngine(optimized_merge_jobseeker::createEngine());
+}
+#endif
\ No newline at end of file
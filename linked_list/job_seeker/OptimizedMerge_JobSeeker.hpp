@@ -9,17 +9,39 @@
 #include <algorithm>
 #include <chrono>
 #include <cmath>
+#include "../../common/CsvLoader.hpp"
+#include "../../common/SkillDictionary.hpp"
+#include "../../common/SkillBitset.hpp"
+#include "../../common/TopK.hpp"
+#include "../../common/CountingRank.hpp"
+#include "../../common/ThreadPool.hpp"
+#include "../../common/MemoryStats.hpp"
+#include "../../common/NodeArena.hpp"
+#include "../../common/Engine.hpp"
 using namespace std;
 using namespace std::chrono;
 
+namespace optimized_merge_jobseeker {
+
+const int TOP_JOBS = 3;   // rows in the Top 3 table
+
+// Skills are interned IDs; SkillDictionary::global() maps them back to text.
+// The arrays grow on demand: allValidSkills holds every distinct job skill,
+// which is as large as the dataset's vocabulary.
 struct SkillList {
-    string skills[100];
-    double weights[100];
-    int size = 0;
+    SkillId* skills;
+    double* weights;
+    int size;
+    int capacity;
+
+    SkillList();
+    SkillList(const SkillList& other);
+    SkillList& operator=(const SkillList& other);
+    ~SkillList();
 
-    void add(const string& skill, double weight = 0.0);
-    bool contains(const string& skill) const;
-    double getWeight(const string& skill) const;
+    void add(SkillId skill, double weight = 0.0);
+    bool contains(SkillId skill) const;
+    double getWeight(SkillId skill) const;
 };
 
 struct Job {
@@ -28,23 +50,37 @@ struct Job {
     double matchScore;
     Job* prev;
     Job* next;
+    WeightedQuery profile{};   // positional skill weights as bit planes
+    bool hasProfile = false;
+    int titleRank = 0;         // alphabetical position of title, equal titles share one
 };
 
 string toLowerCase(const string& str);
 
-void insertAtTail(Job*& head, string title, SkillList skills);
-void loadJobsFromCSV(Job*& head, const string& filename, SkillList& allValidSkills);
+Job* insertAtTail(Job*& head, Job* tail, const string& title, const SkillList& skills, NodeArena& arena);   // returns the new tail
+void loadJobsFromCSV(Job*& head, const string& filename, SkillList& allValidSkills, NodeArena& arena);
+void rankTitles(Job* head);   // fills titleRank
 SkillList insertSkills(const SkillList& allValidSkills);
-void updateAllMatchScores(Job* head, const SkillList& userSkills);
-Job* extractMatchedJobs(Job* head);
+SkillList skillsFromList(const string skills[], int count, const SkillList& allValidSkills);   // non-interactive insertSkills
+// searchMemory / sortMemory receive measured heap deltas in bytes
+void updateAllMatchScores(Job* head, const SkillList& userSkills, double& searchTime, long long& searchMemory);
+Job* extractMatchedJobs(Job* head, NodeArena& scratch);   // copies live until scratch is released
 
-void split(Job* source, Job** frontRef, Job** backRef);
-Job* merge(Job* first, Job* second);
+Job* cutRun(Job* head);               // detaches the leading sorted run, returns the rest
+Job* merge(Job* left, Job* right);    // left must precede right in the list
 int countJobs(Job* head);
-Job* mergeSort(Job* head);
-void sortByScore(Job*& head);
+void mergeSort(Job*& head, double& sortTime, long long& sortMemory);
+void countingSort(Job*& head, double& sortTime, long long& sortMemory);   // same order as mergeSort
+void sortByScore(Job*& head, double& sortTime, long long& sortMemory);
+void selectTopJobs(Job*& head, int k);
+void rankJobs(Job*& head, double& sortTime, long long& sortMemory);   // top-K, merge or counting sort, as the menu does
 
 void displayJobs(Job* head, double minScore);
-void menu(Job*& head, const SkillList& allValidSkills, size_t baselineMemory);
+void menu(Job*& head, const SkillList& allValidSkills);
+
+// Engine for the launcher
+Engine* createEngine();
+
+} // namespace optimized_merge_jobseeker
 
 #endif
\ No newline at end of file
@@ -4,19 +4,12 @@
 #include <string>
 #include <algorithm>
 #include <iomanip>
+#include <cstdint>
+#include "../common/Snapshot.hpp"
+#include "../common/SkillExtractor.hpp"
 using namespace std;
 
-// Convert string to lowercase
-string toLowerStr(const string& s) {
-    string result = s;
-    transform(result.begin(), result.end(), result.begin(), ::tolower);
-    return result;
-}
-
-// Check if 'text' contains 'word' ignoring case
-bool containsIgnoreCase(const string& text, const string& word) {
-    return toLowerStr(text).find(toLowerStr(word)) != string::npos;
-}
+// Build: g++ -std=c++17 data_cleaning_resume.cpp ../common/SkillExtractor.cpp ../common/Snapshot.cpp ../common/CsvLoader.cpp ../common/SkillDictionary.cpp
 
 // Trim leading and trailing spaces
 string trim(const string& s) {
@@ -28,7 +21,6 @@ string trim(const string& s) {
 
 // Custom container structures
 const int MAX_SKILLS = 30;
-const int MAX_CANDIDATES = 1000;
 
 // Represents one candidate
 struct Candidate {
@@ -65,20 +57,98 @@ struct Candidate {
     }
 };
 
-// Custom container that holds all candidates
+// 128-bit fingerprint of a canonical skill set: two independent 64-bit
+// hashes, so distinct sets practically never share one
+struct Fingerprint {
+    uint64_t high;
+    uint64_t low;
+
+    bool operator==(const Fingerprint& other) const {
+        return high == other.high && low == other.low;
+    }
+};
+
+Fingerprint fingerprintOf(const string& text) {
+    uint64_t a = 14695981039346656037ULL;   // FNV-1a
+    uint64_t b = 0x9E3779B97F4A7C15ULL;
+    for (unsigned char ch : text) {
+        a = (a ^ ch) * 1099511628211ULL;
+        b = (b + ch) * 0xBF58476D1CE4E5B9ULL;
+        b ^= b >> 31;
+    }
+    // splitmix64 finalizer so short keys spread over all bits
+    b ^= b >> 30; b *= 0xBF58476D1CE4E5B9ULL;
+    b ^= b >> 27; b *= 0x94D049BB133111EBULL;
+    b ^= b >> 31;
+    return Fingerprint{ a, b };
+}
+
+// Custom container that holds all candidates. Grows by doubling; duplicates
+// are found through an open-addressing table of fingerprints, and a
+// fingerprint hit is confirmed by comparing the skill lists, so insertion
+// stays O(1) expected however many candidates there are.
 struct CandidateContainer {
-    Candidate list[MAX_CANDIDATES];
+    Candidate* list = nullptr;
+    Fingerprint* prints = nullptr;   // fingerprint of list[i]
     int count = 0;
+    int capacity = 0;
+
+    int* slots = nullptr;            // index into list, -1 when empty
+    int slotCount = 0;               // power of two, kept at most half full
+
+    CandidateContainer() = default;
+    CandidateContainer(const CandidateContainer&) = delete;
+    CandidateContainer& operator=(const CandidateContainer&) = delete;
+
+    ~CandidateContainer() {
+        delete[] list;
+        delete[] prints;
+        delete[] slots;
+    }
+
+    void grow() {
+        int newCapacity = capacity == 0 ? 1024 : capacity * 2;
+        Candidate* newList = new Candidate[newCapacity];
+        Fingerprint* newPrints = new Fingerprint[newCapacity];
+        for (int i = 0; i < count; ++i) {
+            newList[i] = move(list[i]);
+            newPrints[i] = prints[i];
+        }
+        delete[] list;
+        delete[] prints;
+        list = newList;
+        prints = newPrints;
+        capacity = newCapacity;
+
+        // Rebuild the table at twice the capacity
+        delete[] slots;
+        slotCount = capacity * 2;
+        slots = new int[slotCount];
+        for (int i = 0; i < slotCount; ++i) slots[i] = -1;
+        for (int i = 0; i < count; ++i) {
+            int slot = (int)(prints[i].low & (slotCount - 1));
+            while (slots[slot] != -1) slot = (slot + 1) & (slotCount - 1);
+            slots[slot] = i;
+        }
+    }
 
     // Add a new candidate if not duplicate
     void addCandidate(const Candidate& c) {
+        if (count == capacity) grow();
+
         string combined = c.combinedSkills();
-        for (int i = 0; i < count; ++i) {
-            if (list[i].combinedSkills() == combined)
+        Fingerprint print = fingerprintOf(combined);
+        int slot = (int)(print.low & (slotCount - 1));
+        while (slots[slot] != -1) {
+            int i = slots[slot];
+            if (prints[i] == print && list[i].combinedSkills() == combined)
                 return; // duplicate, skip
+            slot = (slot + 1) & (slotCount - 1);
         }
-        if (count < MAX_CANDIDATES)
-            list[count++] = c;
+
+        slots[slot] = count;
+        prints[count] = print;
+        list[count++] = c;
     }
 
     // Save to CSV
@@ -119,12 +189,18 @@ int main() {
         "Docker", "Git", "Java", "REST APIs", "Spring Boot", "System Design"
     };
 
+    // One automaton for the whole vocabulary: each line is scanned once
+    SkillExtractor extractor;
+    for (int i = 0; i < MAX_SKILLS; ++i)
+        if (!validSkills[i].empty()) extractor.addSkill(validSkills[i]);
+    extractor.build();
+    int found[MAX_SKILLS];
+
     CandidateContainer container;
     string line;
 
     while (getline(file, line)) {
         if (line.empty()) continue;
-        if (container.count >= MAX_CANDIDATES) break;
 
         // Remove quotes
         if (line.front() == '"' && line.back() == '"')
@@ -144,10 +220,9 @@ int main() {
         // Create a new candidate
         Candidate c;
 
-        for (int i = 0; i < MAX_SKILLS; ++i) {
-            if (containsIgnoreCase(skillsPart, validSkills[i]))
-                c.addSkill(validSkills[i]);
-        }
+        int foundCount = extractor.extract(skillsPart, found);
+        for (int i = 0; i < foundCount; ++i)
+            c.addSkill(extractor.skill(found[i]));
 
         if (c.skillCount == 0) {
             continue;
@@ -161,8 +236,12 @@ int main() {
 
     container.saveToCSV("candidates.csv");
 
+    // Binary twin of the CSV, mapped by the engines at startup
+    if (!SnapshotWriter::convertCsv("candidates.csv", "candidates.bin"))
+        cout << "Failed to create candidates.bin!" << endl;
+
     cout << "Resume data cleaning completed successfully!" << endl;
-    cout << "Output saved to candidates.csv." << endl;
+    cout << "Output saved to candidates.csv and candidates.bin." << endl;
     
     return 0;
 }
\ No newline at end of file